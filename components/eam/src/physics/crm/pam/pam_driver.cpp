@@ -9,6 +9,7 @@
 #include "gcm_forcing.h"
 #include "pam_feedback.h"
 #include "pam_state.h"
+#include "pam_transfer.h"
 #include "pam_radiation.h"
 #include "pam_statistics.h"
 #include "pam_output.h"
@@ -65,6 +66,9 @@ extern "C" void pam_driver() {
   // Allocate the coupler state and retrieve host/device data managers
   coupler.allocate_coupler_state( crm_nz , crm_ny , crm_nx , nens );
 
+  // copy the saved CRM state and GCM input into the persistent transfer buffers
+  pam_transfer_copy_input_to_device(coupler);
+
   // set up the grid - this needs to happen before initializing coupler objects
   pam_state_set_grid(coupler);
   //------------------------------------------------------------------------------------------------
@@ -267,3 +271,8 @@ extern "C" void pam_finalize() {
   // pam::call_kokkos_finalize();
   #endif
 }
+
+// Release the persistent transfer buffers - call before gator_finalize()
+extern "C" void pam_transfer_free() {
+  pam_transfer_finalize();
+}
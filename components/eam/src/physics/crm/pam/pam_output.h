@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pam_coupler.h"
+#include "pam_transfer.h"
 
 // Compute horizontal means for feedback tendencies of variables that are not forced
 inline void pam_output_compute_means( pam::PamCoupler &coupler ) {
@@ -115,23 +116,19 @@ inline void pam_output_copy_to_host( pam::PamCoupler &coupler ) {
   auto gcm_forcing_tend_qtot  = dm_device.get<real const,2>("gcm_forcing_tend_qtot" );
   //------------------------------------------------------------------------------------------------
   // calculate quantites needed for forcing of total water mixing ratio
-  auto gcm_qv = dm_host.get<real const,2>("input_ql").createDeviceCopy();
-  auto gcm_qc = dm_host.get<real const,2>("input_qccl").createDeviceCopy();
-  auto gcm_qi = dm_host.get<real const,2>("input_qiil").createDeviceCopy();
+  // (the final CRM state is still in the transfer buffer from pam_state_copy_to_host)
+  using namespace pam_transfer;
+  auto state = get_buffers().state;
   auto dt_gcm = coupler.get_option<real>("gcm_physics_dt");
   real r_dt_gcm = 1._fp / dt_gcm;
   auto rho_d               = dm_device.get<real,4>("density_dry");
-  auto state_rho_d         = dm_host.get<real const,4>("state_rho_dry").createDeviceCopy();
-  auto state_qv            = dm_host.get<real const,4>("state_qv").createDeviceCopy();
-  auto state_qc            = dm_host.get<real const,4>("state_qc").createDeviceCopy();
-  auto state_qi            = dm_host.get<real const,4>("state_qi").createDeviceCopy();
   real2d crm_hmean_qt   ("crm_hmean_qt"   ,crm_nz,nens);
   parallel_for("Initialize horzontal means", SimpleBounds<2>(crm_nz,nens), YAKL_LAMBDA (int k_crm, int iens) {
     crm_hmean_qt(k_crm,iens) = 0;
   });
   real r_nx_ny  = 1._fp/(crm_nx*crm_ny);  // precompute reciprocal to avoid costly divisions
   parallel_for("Horz mean of CRM state", SimpleBounds<4>(crm_nz,crm_ny,crm_nx,nens), YAKL_LAMBDA (int k_crm, int j, int i, int iens) {
-    real tmp_qt = state_qv(k_crm,j,i,iens) + state_qc(k_crm,j,i,iens) + state_qi(k_crm,j,i,iens);
+    real tmp_qt = state(ST_QV,k_crm,j,i,iens) + state(ST_QC,k_crm,j,i,iens) + state(ST_QI,k_crm,j,i,iens);
     atomicAdd( crm_hmean_qt(k_crm,iens), tmp_qt * r_nx_ny );
   });
   //------------------------------------------------------------------------------------------------
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pam_coupler.h"
+#include "pam_transfer.h"
 #include "Dycore.h"
 
 // wrapper for PAM's set_grid
@@ -18,7 +19,7 @@ inline void pam_state_set_grid( pam::PamCoupler &coupler ) {
   auto crm_dy     = coupler.get_option<real>("crm_dy");
   //------------------------------------------------------------------------------------------------
   // Set the vertical grid in the coupler (need to flip the vertical dimension of input data)
-  auto input_zint = dm_host.get<real const,2>("input_zint").createDeviceCopy();
+  auto input_zint = pam_transfer::input_view(pam_transfer::IN_ZINT,gcm_nlev+1);
   auto input_phis = dm_host.get<real const,1>("input_phis").createDeviceCopy();
   real2d zint_tmp("zint_tmp",crm_nz+1,nens);
   // auto grav = coupler.get_option<double>("grav");
@@ -61,40 +62,32 @@ inline void pam_state_update_gcm_state( pam::PamCoupler &coupler ) {
   auto gcm_rho_c = dm_device.get<real,2>("gcm_cloud_water");
   auto gcm_rho_i = dm_device.get<real,2>("gcm_cloud_ice"  );
   //------------------------------------------------------------------------------------------------
-  // wrap the host GCM state data in YAKL arrays
-  auto input_ul   = dm_host.get<real const,2>("input_ul"  ).createDeviceCopy();
-  auto input_vl   = dm_host.get<real const,2>("input_vl"  ).createDeviceCopy();
-  auto input_tl   = dm_host.get<real const,2>("input_tl"  ).createDeviceCopy();
-  auto input_qccl = dm_host.get<real const,2>("input_qccl").createDeviceCopy();
-  auto input_qiil = dm_host.get<real const,2>("input_qiil").createDeviceCopy();
-  auto input_ql   = dm_host.get<real const,2>("input_ql"  ).createDeviceCopy();
-  auto input_pmid = dm_host.get<real const,2>("input_pmid").createDeviceCopy();
-  auto input_pint = dm_host.get<real const,2>("input_pint").createDeviceCopy();
-  auto input_zint = dm_host.get<real const,2>("input_zint").createDeviceCopy();
+  // GCM state already copied to the device by pam_transfer_copy_input_to_device()
+  using namespace pam_transfer;
+  auto input = get_buffers().input;
   //------------------------------------------------------------------------------------------------
   // Define GCM state for forcing
   parallel_for( SimpleBounds<2>(crm_nz+1,nens) , YAKL_LAMBDA (int k_crm, int iens) {
-    int k_gcm = (gcm_nlev+1)-1-k_crm;
-    gcm_pint(k_crm,iens) = input_pint(k_gcm,iens);
-  });
-  parallel_for(SimpleBounds<2>(crm_nz,nens), YAKL_LAMBDA (int k_crm, int iens) {
-    int k_gcm = gcm_nlev-1-k_crm;
-
-    gcm_uvel (k_crm,iens) = input_ul(k_gcm,iens);
-    gcm_vvel (k_crm,iens) = input_vl(k_gcm,iens);
+    gcm_pint(k_crm,iens) = input(IN_PINT,(gcm_nlev+1)-1-k_crm,iens);
+    if (k_crm < crm_nz) {
+      int k_gcm = gcm_nlev-1-k_crm;
 
-    // calculate dry density using same formula as in crm_physics_tend()
-    real dz = input_zint(k_gcm,iens) - input_zint(k_gcm+1,iens);
-    real dp = input_pint(k_gcm,iens) - input_pint(k_gcm+1,iens);
-    gcm_rho_d(k_crm,iens) = -1 * dp * (1-input_ql(k_gcm,iens)) / ( dz * grav );
+      gcm_uvel (k_crm,iens) = input(IN_UL,k_gcm,iens);
+      gcm_vvel (k_crm,iens) = input(IN_VL,k_gcm,iens);
 
-    gcm_pmid(k_crm,iens) = input_pmid(k_gcm,iens);
+      // calculate dry density using same formula as in crm_physics_tend()
+      real dz = input(IN_ZINT,k_gcm,iens) - input(IN_ZINT,k_gcm+1,iens);
+      real dp = input(IN_PINT,k_gcm,iens) - input(IN_PINT,k_gcm+1,iens);
+      real ql = input(IN_QL,k_gcm,iens);
+      gcm_rho_d(k_crm,iens) = -1 * dp * (1-ql) / ( dz * grav );
 
-    gcm_rho_v(k_crm,iens) = input_ql(k_gcm,iens) * gcm_rho_d(k_crm,iens) / ( 1 - input_ql(k_gcm,iens) );
-    gcm_rho_c(k_crm,iens) = input_qccl(k_gcm,iens) * ( gcm_rho_d(k_crm,iens) + gcm_rho_v(k_crm,iens) );
-    gcm_rho_i(k_crm,iens) = input_qiil(k_gcm,iens) * ( gcm_rho_d(k_crm,iens) + gcm_rho_v(k_crm,iens) );
-    gcm_temp(k_crm,iens)  = input_tl(k_gcm,iens);
+      gcm_pmid(k_crm,iens) = input(IN_PMID,k_gcm,iens);
 
+      gcm_rho_v(k_crm,iens) = ql * gcm_rho_d(k_crm,iens) / ( 1 - ql );
+      gcm_rho_c(k_crm,iens) = input(IN_QCCL,k_gcm,iens) * ( gcm_rho_d(k_crm,iens) + gcm_rho_v(k_crm,iens) );
+      gcm_rho_i(k_crm,iens) = input(IN_QIIL,k_gcm,iens) * ( gcm_rho_d(k_crm,iens) + gcm_rho_v(k_crm,iens) );
+      gcm_temp(k_crm,iens)  = input(IN_TL,k_gcm,iens);
+    }
   });
   //------------------------------------------------------------------------------------------------
 }
@@ -317,65 +310,46 @@ inline void pam_state_copy_input_to_coupler( pam::PamCoupler &coupler ) {
   auto nc_nuceat_tend    = dm_device.get<real,4>("nc_nuceat_tend");
   auto ni_activated      = dm_device.get<real,4>("ni_activated");
   //------------------------------------------------------------------------------------------------
-  // wrap the host CRM state data in YAKL arrays
-  auto state_u_wind          = dm_host.get<real const,4>("state_u_wind").createDeviceCopy();
-  auto state_v_wind          = dm_host.get<real const,4>("state_v_wind").createDeviceCopy();
-  auto state_w_wind          = dm_host.get<real const,4>("state_w_wind").createDeviceCopy();
-  auto state_temperature     = dm_host.get<real const,4>("state_temperature").createDeviceCopy();
-  auto state_rho_dry         = dm_host.get<real const,4>("state_rho_dry").createDeviceCopy();
-  auto state_qv              = dm_host.get<real const,4>("state_qv").createDeviceCopy();
-  auto state_qc              = dm_host.get<real const,4>("state_qc").createDeviceCopy();
-  auto state_qr              = dm_host.get<real const,4>("state_qr").createDeviceCopy();
-  auto state_qi              = dm_host.get<real const,4>("state_qi").createDeviceCopy();
-  auto state_nc              = dm_host.get<real const,4>("state_nc").createDeviceCopy();
-  auto state_nr              = dm_host.get<real const,4>("state_nr").createDeviceCopy();
-  auto state_ni              = dm_host.get<real const,4>("state_ni").createDeviceCopy();
-  auto state_qm              = dm_host.get<real const,4>("state_qm").createDeviceCopy();
-  auto state_bm              = dm_host.get<real const,4>("state_bm").createDeviceCopy();
-  auto state_t_prev          = dm_host.get<real const,4>("state_t_prev").createDeviceCopy();
-  auto state_q_prev          = dm_host.get<real const,4>("state_q_prev").createDeviceCopy();
-  auto state_shoc_tk         = dm_host.get<real const,4>("state_shoc_tk").createDeviceCopy();
-  auto state_shoc_tkh        = dm_host.get<real const,4>("state_shoc_tkh").createDeviceCopy();
-  auto state_shoc_wthv       = dm_host.get<real const,4>("state_shoc_wthv").createDeviceCopy();
-  auto state_shoc_relvar     = dm_host.get<real const,4>("state_shoc_relvar").createDeviceCopy();
-  auto state_shoc_cldfrac    = dm_host.get<real const,4>("state_shoc_cldfrac").createDeviceCopy();
-  auto input_nccn_prescribed = dm_host.get<real const,2>("input_nccn_prescribed").createDeviceCopy();
-  auto input_nc_nuceat_tend  = dm_host.get<real const,2>("input_nc_nuceat_tend").createDeviceCopy();
-  auto input_ni_activated    = dm_host.get<real const,2>("input_ni_activated").createDeviceCopy();
+  // CRM state and GCM input already copied to the device by pam_transfer_copy_input_to_device()
+  using namespace pam_transfer;
+  auto state = get_buffers().state;
+  auto input = get_buffers().input;
   //------------------------------------------------------------------------------------------------
-  // Copy the host CRM data to the coupler
+  // Copy the CRM state to the coupler
   parallel_for( "Copy in old CRM state",
                 SimpleBounds<4>(nz,ny,nx,nens),
                 YAKL_LAMBDA (int k, int j, int i, int iens) {
     int k_gcm = gcm_nlev-1-k;
-    crm_rho_d        (k,j,i,iens) = state_rho_dry(k,j,i,iens);
+    real rho_dry = state(ST_RHO_D,k,j,i,iens);
+    real qv      = state(ST_QV   ,k,j,i,iens);
+    crm_rho_d        (k,j,i,iens) = rho_dry;
     // NOTE - convert specific mass mixing ratios to density using previous state dry density from pbuf
-    crm_rho_v        (k,j,i,iens) = state_qv(k,j,i,iens) * state_rho_dry(k,j,i,iens) / ( 1 - state_qv(k,j,i,iens) ) ;
-    real rho_total = state_rho_dry(k,j,i,iens) + crm_rho_v(k,j,i,iens);
-    crm_rho_c        (k,j,i,iens) = state_qc(k,j,i,iens) * rho_total ;
-    crm_rho_r        (k,j,i,iens) = state_qr(k,j,i,iens) * rho_total ;
-    crm_rho_i        (k,j,i,iens) = state_qi(k,j,i,iens) * rho_total ;
-    crm_uvel         (k,j,i,iens) = state_u_wind         (k,j,i,iens);
-    crm_vvel         (k,j,i,iens) = state_v_wind         (k,j,i,iens);
-    crm_wvel         (k,j,i,iens) = state_w_wind         (k,j,i,iens);
-    crm_temp         (k,j,i,iens) = state_temperature    (k,j,i,iens);
-    crm_nc           (k,j,i,iens) = state_nc             (k,j,i,iens);
-    crm_nr           (k,j,i,iens) = state_nr             (k,j,i,iens);
-    crm_ni           (k,j,i,iens) = state_ni             (k,j,i,iens);
-    crm_qm           (k,j,i,iens) = state_qm             (k,j,i,iens);
-    crm_bm           (k,j,i,iens) = state_bm             (k,j,i,iens);
+    crm_rho_v        (k,j,i,iens) = qv * rho_dry / ( 1 - qv ) ;
+    real rho_total = rho_dry + crm_rho_v(k,j,i,iens);
+    crm_rho_c        (k,j,i,iens) = state(ST_QC,k,j,i,iens) * rho_total ;
+    crm_rho_r        (k,j,i,iens) = state(ST_QR,k,j,i,iens) * rho_total ;
+    crm_rho_i        (k,j,i,iens) = state(ST_QI,k,j,i,iens) * rho_total ;
+    crm_uvel         (k,j,i,iens) = state(ST_UVEL        ,k,j,i,iens);
+    crm_vvel         (k,j,i,iens) = state(ST_VVEL        ,k,j,i,iens);
+    crm_wvel         (k,j,i,iens) = state(ST_WVEL        ,k,j,i,iens);
+    crm_temp         (k,j,i,iens) = state(ST_TEMP        ,k,j,i,iens);
+    crm_nc           (k,j,i,iens) = state(ST_NC          ,k,j,i,iens);
+    crm_nr           (k,j,i,iens) = state(ST_NR          ,k,j,i,iens);
+    crm_ni           (k,j,i,iens) = state(ST_NI          ,k,j,i,iens);
+    crm_qm           (k,j,i,iens) = state(ST_QM          ,k,j,i,iens);
+    crm_bm           (k,j,i,iens) = state(ST_BM          ,k,j,i,iens);
     // shoc inputs
-    crm_shoc_tk      (k,j,i,iens) = state_shoc_tk        (k,j,i,iens);
-    crm_shoc_tkh     (k,j,i,iens) = state_shoc_tkh       (k,j,i,iens);
-    crm_shoc_wthv    (k,j,i,iens) = state_shoc_wthv      (k,j,i,iens);
-    crm_shoc_relvar  (k,j,i,iens) = state_shoc_relvar    (k,j,i,iens);
-    crm_shoc_cldfrac (k,j,i,iens) = state_shoc_cldfrac   (k,j,i,iens);
+    crm_shoc_tk      (k,j,i,iens) = state(ST_SHOC_TK     ,k,j,i,iens);
+    crm_shoc_tkh     (k,j,i,iens) = state(ST_SHOC_TKH    ,k,j,i,iens);
+    crm_shoc_wthv    (k,j,i,iens) = state(ST_SHOC_WTHV   ,k,j,i,iens);
+    crm_shoc_relvar  (k,j,i,iens) = state(ST_SHOC_RELVAR ,k,j,i,iens);
+    crm_shoc_cldfrac (k,j,i,iens) = state(ST_SHOC_CLDFRAC,k,j,i,iens);
     // p3 inputs
-    crm_t_prev       (k,j,i,iens) = state_t_prev         (k,j,i,iens);
-    crm_q_prev       (k,j,i,iens) = state_q_prev         (k,j,i,iens);
-    nccn_prescribed  (k,j,i,iens) = input_nccn_prescribed(k_gcm,iens);
-    nc_nuceat_tend   (k,j,i,iens) = input_nc_nuceat_tend (k_gcm,iens);
-    ni_activated     (k,j,i,iens) = input_ni_activated   (k_gcm,iens);
+    crm_t_prev       (k,j,i,iens) = state(ST_T_PREV      ,k,j,i,iens);
+    crm_q_prev       (k,j,i,iens) = state(ST_Q_PREV      ,k,j,i,iens);
+    nccn_prescribed  (k,j,i,iens) = input(IN_NCCN        ,k_gcm,iens);
+    nc_nuceat_tend   (k,j,i,iens) = input(IN_NC_NUCEAT   ,k_gcm,iens);
+    ni_activated     (k,j,i,iens) = input(IN_NI_ACTIVATED,k_gcm,iens);
   });
   //------------------------------------------------------------------------------------------------
   // // Set surface fluxes here if being used or applied in SHOC
@@ -425,67 +399,41 @@ inline void pam_state_copy_to_host( pam::PamCoupler &coupler ) {
   auto crm_shoc_relvar          = dm_device.get<real,4>("inv_qc_relvar");
   auto crm_shoc_cldfrac         = dm_device.get<real,4>("cldfrac");
   //------------------------------------------------------------------------------------------------
-  // wrap the host CRM state data in YAKL arrays
-  auto host_state_u_wind        = dm_host.get<real,4>("state_u_wind");
-  auto host_state_v_wind        = dm_host.get<real,4>("state_v_wind");
-  auto host_state_w_wind        = dm_host.get<real,4>("state_w_wind");
-  auto host_state_temperature   = dm_host.get<real,4>("state_temperature");
-  auto host_state_rho_dry       = dm_host.get<real,4>("state_rho_dry");
-  auto host_state_qv            = dm_host.get<real,4>("state_qv");
-  auto host_state_qc            = dm_host.get<real,4>("state_qc");
-  auto host_state_qr            = dm_host.get<real,4>("state_qr");
-  auto host_state_qi            = dm_host.get<real,4>("state_qi");
-  auto host_state_nc            = dm_host.get<real,4>("state_nc");
-  auto host_state_nr            = dm_host.get<real,4>("state_nr");
-  auto host_state_ni            = dm_host.get<real,4>("state_ni");
-  auto host_state_qm            = dm_host.get<real,4>("state_qm");
-  auto host_state_bm            = dm_host.get<real,4>("state_bm");
-  auto host_state_t_prev        = dm_host.get<real,4>("state_t_prev");
-  auto host_state_q_prev        = dm_host.get<real,4>("state_q_prev");
-  auto host_state_shoc_tk       = dm_host.get<real,4>("state_shoc_tk");
-  auto host_state_shoc_tkh      = dm_host.get<real,4>("state_shoc_tkh");
-  auto host_state_shoc_wthv     = dm_host.get<real,4>("state_shoc_wthv");
-  auto host_state_shoc_relvar   = dm_host.get<real,4>("state_shoc_relvar");
-  auto host_state_shoc_cldfrac  = dm_host.get<real,4>("state_shoc_cldfrac");
-  //------------------------------------------------------------------------------------------------
-  // convert densities back to specific mixing ratios
-  real4d tmp_qv("tmp_qv",nz,ny,nx,nens);
-  real4d tmp_qc("tmp_qc",nz,ny,nx,nens);
-  real4d tmp_qr("tmp_qr",nz,ny,nx,nens);
-  real4d tmp_qi("tmp_qi",nz,ny,nx,nens);
-  parallel_for( "convert state densities to mixing ratios",
+  // Pack the CRM state into the transfer buffer, converting densities back to
+  // specific mixing ratios
+  using namespace pam_transfer;
+  auto state = get_buffers().state;
+  parallel_for( "Copy out CRM state",
                 SimpleBounds<4>(nz,ny,nx,nens),
                 YAKL_LAMBDA (int k, int j, int i, int iens) {
-    // convert density to specific mixing ratio
     real rho_total = crm_rho_d(k,j,i,iens) + crm_rho_v(k,j,i,iens);
-    tmp_qv(k,j,i,iens) = crm_rho_v(k,j,i,iens) / rho_total;
-    tmp_qc(k,j,i,iens) = crm_rho_c(k,j,i,iens) / rho_total;
-    tmp_qr(k,j,i,iens) = crm_rho_r(k,j,i,iens) / rho_total;
-    tmp_qi(k,j,i,iens) = crm_rho_i(k,j,i,iens) / rho_total;
+    state(ST_UVEL        ,k,j,i,iens) = crm_uvel        (k,j,i,iens);
+    state(ST_VVEL        ,k,j,i,iens) = crm_vvel        (k,j,i,iens);
+    state(ST_WVEL        ,k,j,i,iens) = crm_wvel        (k,j,i,iens);
+    state(ST_TEMP        ,k,j,i,iens) = crm_temp        (k,j,i,iens);
+    state(ST_RHO_D       ,k,j,i,iens) = crm_rho_d       (k,j,i,iens);
+    state(ST_QV          ,k,j,i,iens) = crm_rho_v       (k,j,i,iens) / rho_total;
+    state(ST_QC          ,k,j,i,iens) = crm_rho_c       (k,j,i,iens) / rho_total;
+    state(ST_QR          ,k,j,i,iens) = crm_rho_r       (k,j,i,iens) / rho_total;
+    state(ST_QI          ,k,j,i,iens) = crm_rho_i       (k,j,i,iens) / rho_total;
+    state(ST_NC          ,k,j,i,iens) = crm_num_c       (k,j,i,iens);
+    state(ST_NR          ,k,j,i,iens) = crm_num_r       (k,j,i,iens);
+    state(ST_NI          ,k,j,i,iens) = crm_num_i       (k,j,i,iens);
+    state(ST_QM          ,k,j,i,iens) = crm_qm          (k,j,i,iens);
+    state(ST_BM          ,k,j,i,iens) = crm_bm          (k,j,i,iens);
+    state(ST_T_PREV      ,k,j,i,iens) = crm_t_prev      (k,j,i,iens);
+    state(ST_Q_PREV      ,k,j,i,iens) = crm_q_prev      (k,j,i,iens);
+    state(ST_SHOC_TK     ,k,j,i,iens) = crm_shoc_tk     (k,j,i,iens);
+    state(ST_SHOC_TKH    ,k,j,i,iens) = crm_shoc_tkh    (k,j,i,iens);
+    state(ST_SHOC_WTHV   ,k,j,i,iens) = crm_shoc_wthv   (k,j,i,iens);
+    state(ST_SHOC_RELVAR ,k,j,i,iens) = crm_shoc_relvar (k,j,i,iens);
+    state(ST_SHOC_CLDFRAC,k,j,i,iens) = crm_shoc_cldfrac(k,j,i,iens);
   });
   //------------------------------------------------------------------------------------------------
   // Copy the CRM state to host arrays
-  crm_uvel          .deep_copy_to( host_state_u_wind        );
-  crm_vvel          .deep_copy_to( host_state_v_wind        );
-  crm_wvel          .deep_copy_to( host_state_w_wind        );
-  crm_temp          .deep_copy_to( host_state_temperature   );
-  crm_rho_d         .deep_copy_to( host_state_rho_dry       );
-  tmp_qv            .deep_copy_to( host_state_qv            );
-  tmp_qc            .deep_copy_to( host_state_qc            );
-  tmp_qi            .deep_copy_to( host_state_qi            );
-  tmp_qr            .deep_copy_to( host_state_qr            );
-  crm_num_c         .deep_copy_to( host_state_nc            );
-  crm_num_r         .deep_copy_to( host_state_nr            );
-  crm_num_i         .deep_copy_to( host_state_ni            );
-  crm_qm            .deep_copy_to( host_state_qm            );
-  crm_bm            .deep_copy_to( host_state_bm            );
-  crm_t_prev        .deep_copy_to( host_state_t_prev        );
-  crm_q_prev        .deep_copy_to( host_state_q_prev        );
-  crm_shoc_tk       .deep_copy_to( host_state_shoc_tk       );
-  crm_shoc_tkh      .deep_copy_to( host_state_shoc_tkh      );
-  crm_shoc_wthv     .deep_copy_to( host_state_shoc_wthv     );
-  crm_shoc_relvar   .deep_copy_to( host_state_shoc_relvar   );
-  crm_shoc_cldfrac  .deep_copy_to( host_state_shoc_cldfrac  );
+  for (int v=0; v<NUM_ST; v++) {
+    state_view(v).deep_copy_to( dm_host.get<real,4>(state_names[v]) );
+  }
   yakl::fence();
   //------------------------------------------------------------------------------------------------
 }
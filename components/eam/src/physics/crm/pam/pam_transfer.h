@@ -0,0 +1,116 @@
+#pragma once
+
+#include "pam_coupler.h"
+
+// Persistent device buffers used to move data between the GCM and the PAM
+// coupler. The coupler and its data managers are rebuilt on every CRM call, so
+// these buffers are kept outside of it: they are allocated on the first call,
+// reallocated only if the CRM dimensions change, and released by pam_transfer_free(),
+// which must run before gator_finalize() since they come from the YAKL pool.
+// Each buffer stores one variable per leading index, so the host data is copied
+// into preallocated memory and a single kernel moves all of the variables into
+// or out of the coupler.
+
+namespace pam_transfer {
+
+  // CRM state saved by the GCM between calls (copied in and out)
+  enum { ST_UVEL, ST_VVEL, ST_WVEL, ST_TEMP, ST_RHO_D, ST_QV, ST_QC, ST_QR, ST_QI,
+         ST_NC, ST_NR, ST_NI, ST_QM, ST_BM, ST_T_PREV, ST_Q_PREV,
+         ST_SHOC_TK, ST_SHOC_TKH, ST_SHOC_WTHV, ST_SHOC_RELVAR, ST_SHOC_CLDFRAC, NUM_ST };
+  char const * const state_names[NUM_ST] = {
+    "state_u_wind", "state_v_wind", "state_w_wind", "state_temperature", "state_rho_dry",
+    "state_qv", "state_qc", "state_qr", "state_qi", "state_nc", "state_nr", "state_ni",
+    "state_qm", "state_bm", "state_t_prev", "state_q_prev", "state_shoc_tk", "state_shoc_tkh",
+    "state_shoc_wthv", "state_shoc_relvar", "state_shoc_cldfrac" };
+
+  // GCM column input on GCM levels (pint and zint are on gcm_nlev+1 interfaces)
+  enum { IN_UL, IN_VL, IN_TL, IN_QCCL, IN_QIIL, IN_QL, IN_PMID, IN_PINT, IN_ZINT,
+         IN_NCCN, IN_NC_NUCEAT, IN_NI_ACTIVATED, NUM_IN };
+  char const * const input_names[NUM_IN] = {
+    "input_ul", "input_vl", "input_tl", "input_qccl", "input_qiil", "input_ql",
+    "input_pmid", "input_pint", "input_zint",
+    "input_nccn_prescribed", "input_nc_nuceat_tend", "input_ni_activated" };
+
+  // CRM feedback tendencies on GCM levels (copied out)
+  enum { TEND_UVEL, TEND_VVEL, TEND_DSE, TEND_QV, TEND_QC, TEND_QI, NUM_TEND };
+  char const * const tend_names[NUM_TEND] = {
+    "output_ultend", "output_vltend", "output_sltend",
+    "output_qltend", "output_qcltend", "output_qiltend" };
+
+  struct Buffers {
+    real5d state;  // (NUM_ST  , nz, ny, nx, nens)
+    real3d input;  // (NUM_IN  , gcm_nlev+1, nens)
+    real3d tend;   // (NUM_TEND, gcm_nlev  , nens)
+  };
+
+  inline Buffers &get_buffers() {
+    static Buffers buffers;
+    return buffers;
+  }
+
+  // non-owning device view of variable v of the state buffer
+  inline real4d state_view( int v ) {
+    auto &state = get_buffers().state;
+    int nz = state.extent(1), ny = state.extent(2), nx = state.extent(3), nens = state.extent(4);
+    return real4d( state_names[v], state.data() + (size_t) v*nz*ny*nx*nens, nz, ny, nx, nens );
+  }
+
+  // non-owning device view of GCM input variable v (nlev levels, or nlev+1 for interfaces)
+  inline real2d input_view( int v , int nlev ) {
+    auto &input = get_buffers().input;
+    int nens = input.extent(2);
+    return real2d( input_names[v], input.data() + (size_t) v*input.extent(1)*nens, nlev, nens );
+  }
+
+  // non-owning device view of feedback tendency v
+  inline real2d tend_view( int v ) {
+    auto &tend = get_buffers().tend;
+    int nlev = tend.extent(1), nens = tend.extent(2);
+    return real2d( tend_names[v], tend.data() + (size_t) v*nlev*nens, nlev, nens );
+  }
+
+}
+
+
+// Allocate the transfer buffers if needed, then copy the CRM state saved by the GCM and
+// the GCM column input into them. This is the only host-to-device copy of these fields.
+inline void pam_transfer_copy_input_to_device( pam::PamCoupler &coupler ) {
+  using namespace pam_transfer;
+  auto &dm_host   = coupler.get_data_manager_host_readwrite();
+  auto nens       = coupler.get_option<int>("ncrms");
+  auto nz         = coupler.get_option<int>("crm_nz");
+  auto nx         = coupler.get_option<int>("crm_nx");
+  auto ny         = coupler.get_option<int>("crm_ny");
+  auto gcm_nlev   = coupler.get_option<int>("gcm_nlev");
+  auto &buffers   = get_buffers();
+  //------------------------------------------------------------------------------------------------
+  bool resize = ! buffers.state.initialized();
+  if (! resize) {
+    resize = buffers.state.extent(1) != nz || buffers.state.extent(2) != ny ||
+             buffers.state.extent(3) != nx || buffers.state.extent(4) != nens ||
+             buffers.input.extent(1) != gcm_nlev+1;
+  }
+  if (resize) {
+    buffers.state = real5d("pam_transfer_state", NUM_ST  , nz, ny, nx, nens);
+    buffers.input = real3d("pam_transfer_input", NUM_IN  , gcm_nlev+1, nens);
+    buffers.tend  = real3d("pam_transfer_tend" , NUM_TEND, gcm_nlev  , nens);
+  }
+  //------------------------------------------------------------------------------------------------
+  for (int v=0; v<NUM_ST; v++) {
+    dm_host.get<real const,4>(state_names[v]).deep_copy_to( state_view(v) );
+  }
+  for (int v=0; v<NUM_IN; v++) {
+    int nlev = (v == IN_PINT || v == IN_ZINT) ? gcm_nlev+1 : gcm_nlev;
+    dm_host.get<real const,2>(input_names[v]).deep_copy_to( input_view(v,nlev) );
+  }
+  //------------------------------------------------------------------------------------------------
+}
+
+
+// Release the transfer buffers - called from pam_transfer_free()
+inline void pam_transfer_finalize() {
+  auto &buffers = pam_transfer::get_buffers();
+  buffers.state = real5d();
+  buffers.input = real3d();
+  buffers.tend  = real3d();
+}
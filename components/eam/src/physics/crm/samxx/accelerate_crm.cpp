@@ -22,16 +22,17 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   real tmin = 50.0;  // should never get below 50K in crm, following UP-CAM implementation
   int idx_qt = index_water_vapor;
 
-  real2d ubaccel("ubaccel", nzm, ncrms);
-  real2d vbaccel("vbaccel", nzm, ncrms);
-  real2d tbaccel("tbaccel", nzm, ncrms);
-  real2d qtbaccel("qtbaccel", nzm, ncrms);
-  real2d ttend_acc("ttend_acc", nzm, ncrms);
-  real2d qtend_acc("qtend_acc", nzm, ncrms);
-  real2d utend_acc("utend_acc", nzm, ncrms);
-  real2d vtend_acc("vtend_acc", nzm, ncrms);
-  real2d qpoz("qpoz", nzm, ncrms);
-  real2d qneg("qneg", nzm, ncrms);
+  ArenaScope arena_scope;
+  real2d ubaccel = arena_array<real2d>("ubaccel", nzm, ncrms);
+  real2d vbaccel = arena_array<real2d>("vbaccel", nzm, ncrms);
+  real2d tbaccel = arena_array<real2d>("tbaccel", nzm, ncrms);
+  real2d qtbaccel = arena_array<real2d>("qtbaccel", nzm, ncrms);
+  real2d ttend_acc = arena_array<real2d>("ttend_acc", nzm, ncrms);
+  real2d qtend_acc = arena_array<real2d>("qtend_acc", nzm, ncrms);
+  real2d utend_acc = arena_array<real2d>("utend_acc", nzm, ncrms);
+  real2d vtend_acc = arena_array<real2d>("vtend_acc", nzm, ncrms);
+  real2d qpoz = arena_array<real2d>("qpoz", nzm, ncrms);
+  real2d qneg = arena_array<real2d>("qneg", nzm, ncrms);
 
   // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
   // Compute the average among horizontal columns for each variable
@@ -169,7 +170,7 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
       // Clip qt values at 0 and remove the negative excess in each layer
       // proportionally from the positive qt fields in the layer
       factor = 1.0 + qneg(k,icrm) / qpoz(k,icrm);
-      micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) = max(0.0, micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) * factor);
+      micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) = max((real) 0.0, micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) * factor);
       // Partition micro_field == qv + qcl + qci following these rules:
       //    (1) attempt to satisfy purely by adjusting qv
       //    (2) adjust qcl and qci only if needed to ensure positivity
@@ -180,7 +181,7 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
       } else {
         // deduce qv as residual between qt - qcl - qci
         real qt_res = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) - qcl(k,j,i,icrm) - qci(k,j,i,icrm);
-        qv(k,j,i,icrm) = max(0.0, qt_res);
+        qv(k,j,i,icrm) = max((real) 0.0, qt_res);
         if (qt_res < 0.0) {
           // qv was clipped; need to reduce qcl and qci accordingly
           factor = 1.0 + qt_res / (qcl(k,j,i,icrm) + qci(k,j,i,icrm));
@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "vars.h"
+#include "arena.h"
 
 void accelerate_crm(int nstep, int nstop, bool &ceaseflag);
 
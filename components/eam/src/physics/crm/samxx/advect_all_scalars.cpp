@@ -13,14 +13,20 @@ void advect_all_scalars() {
   // advection of scalars :
   advect_scalar(t,dummy,dummy);
 
-  // Advection of microphysics prognostics:
+  // Advection of microphysics prognostics, all fields in one set of passes:
+  adv_fields micro_ind;
+  int nmicro_adv = 0;
   for (int k=0; k<nmicro_fields; k++) {
     if ( k==index_water_vapor || (docloud && flag_precip(k)!=1) || (doprecip && flag_precip(k)==1) ) {
-      advect_scalar(micro_field,k,mkadv,k,mkwle,k);  
+      micro_ind(nmicro_adv) = k;
+      nmicro_adv++;
     }
   }
+  if (nmicro_adv > 0) {
+    advect_scalar(micro_field,nmicro_adv,micro_ind,mkadv,micro_ind,mkwle,micro_ind);
+  }
 
-  // Advection of sgs prognostics:
+  // Advection of sgs prognostics (one field with SGS_TKE, so no fusion):
   if (dosgs && advect_sgs) {
     for (int k=0; k<nsgs_fields; k++) {
       advect_scalar(sgs_field,k,dummy,dummy);
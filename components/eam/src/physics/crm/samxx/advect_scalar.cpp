@@ -142,3 +142,51 @@ void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flu
   }  
 
 }
+
+void advect_scalar(real5d &f, int nfld, adv_fields const &ind_f, real3d &fadv, adv_fields const &ind_fadv,
+                   real3d &flux, adv_fields const &ind_flux) {
+  YAKL_SCOPE( ncrms          , :: ncrms);
+
+  if (docolumn || !RUN3D) {
+    // The fused passes only exist for the 3D scheme
+    for (int l=0; l<nfld; l++) {
+      advect_scalar(f,ind_f(l),fadv,ind_fadv(l),flux,ind_flux(l));
+    }
+    return;
+  }
+
+  ArenaScope arena_scope;
+  real5d f0 = arena_array<real5d>("f0", nfld, nzm, dimy_s, dimx_s, ncrms);
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<dimy_s; j++) {
+  //     for (int i=0; i<dimx_s; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    for (int l=0; l<nfld; l++) {
+      f0(l,k,j,i,icrm) = f(ind_f(l),k,j,i,icrm);
+    }
+  });
+
+  advect_scalar3D(f,nfld,ind_f,flux,ind_flux);
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    for (int l=0; l<nfld; l++) {
+      fadv(ind_fadv(l),k,icrm)=0.0;
+    }
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny; j++) {
+  //     for (int i=0; i<nx; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    for (int l=0; l<nfld; l++) {
+      real tmp = f(ind_f(l),k,j+offy_s,i+offx_s,icrm)-f0(l,k,j+offy_s,i+offx_s,icrm);
+      yakl::atomicAdd(fadv(ind_fadv(l),k,icrm),tmp);
+    }
+  });
+
+}
@@ -72,10 +72,10 @@ void advect_scalar2D(real4d &f, real2d &flux) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
     int kb=max(0,k-1);
-    uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(k,j,i-1+offx_s-2,icrm)+
-                    min(0.0,u(k,j,i,icrm))*f(k,j,i+offx_s-2,icrm);
+    uuu(k,j,i,icrm)=max((real) 0.0,u(k,j,i,icrm))*f(k,j,i-1+offx_s-2,icrm)+
+                    min((real) 0.0,u(k,j,i,icrm))*f(k,j,i+offx_s-2,icrm);
     if (i <= nx+3) {
-      www(k,j,i,icrm)=max(0.0,w(k,j,i,icrm))*f(kb,j,i+offx_s-2,icrm)+min(0.0,w(k,j,i,icrm))*f(k,j,i+offx_s-2,icrm);
+      www(k,j,i,icrm)=max((real) 0.0,w(k,j,i,icrm))*f(kb,j,i+offx_s-2,icrm)+min((real) 0.0,w(k,j,i,icrm))*f(k,j,i+offx_s-2,icrm);
     }
     if (i == 1) {
       flux(k,icrm) = 0.0;
@@ -166,13 +166,13 @@ void advect_scalar2D(real4d &f, real2d &flux) {
     parallel_for( SimpleBounds<3>(nzm,nx+1,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
       int ib=i-1;
       uuu(k,j,i+offx_uuu,icrm) =
-            pp2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(k,j,ib+offx_m,icrm))) -
-            pn2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,ib+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
+            pp2(uuu(k,j,i+offx_uuu,icrm))*min((real) 1.0,min(mx(k,j,i+offx_m,icrm), mn(k,j,ib+offx_m,icrm))) -
+            pn2(uuu(k,j,i+offx_uuu,icrm))*min((real) 1.0,min(mx(k,j,ib+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
       if (i <= nx-1) {
         int kb=max(0,k-1);
         www(k,j,i+offx_www,icrm) =
-            pp2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(kb,j,i+offx_m,icrm))) -
-            pn2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
+            pp2(www(k,j,i+offx_www,icrm))*min((real) 1.0,min(mx(k,j,i+offx_m,icrm), mn(kb,j,i+offx_m,icrm))) -
+            pn2(www(k,j,i+offx_www,icrm))*min((real) 1.0,min(mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
         yakl::atomicAdd(flux(k,icrm), www(k,j,i+offx_www,icrm));
       }
     });
@@ -187,7 +187,7 @@ void advect_scalar2D(real4d &f, real2d &flux) {
     //     especially  when such large numbers as
     //     hydrometeor concentrations are advected. The reason for negative values is
     //     most likely truncation error.
-    f(k,j,i+offx_s,icrm)= max(0.0, f(k,j,i+offx_s,icrm) - (uuu(k,j,i+1+offx_uuu,icrm)-uuu(k,j,i+offx_uuu,icrm) +
+    f(k,j,i+offx_s,icrm)= max((real) 0.0, f(k,j,i+offx_s,icrm) - (uuu(k,j,i+1+offx_uuu,icrm)-uuu(k,j,i+offx_uuu,icrm) +
                          (www(k+1,j,i+offx_www,icrm)-www(k,j,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
   });
 
@@ -267,11 +267,11 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
     int kb=max(0,k-1);
-    uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i-1+offx_s-2,icrm)+
-                    min(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
+    uuu(k,j,i,icrm)=max((real) 0.0,u(k,j,i,icrm))*f(ind_f,k,j,i-1+offx_s-2,icrm)+
+                    min((real) 0.0,u(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
     if (i <= nx+3) {
-      www(k,j,i,icrm) = max(0.0,w(k,j,i,icrm))*f(ind_f,kb,j,i+offx_s-2,icrm)+
-                        min(0.0,w(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
+      www(k,j,i,icrm) = max((real) 0.0,w(k,j,i,icrm))*f(ind_f,kb,j,i+offx_s-2,icrm)+
+                        min((real) 0.0,w(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
     }
     if (i == 1) {
       flux(k,icrm) = 0.0;
@@ -364,12 +364,12 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
     //    for (int icrm=0; icrm<ncrms; icrm++) {
     parallel_for( SimpleBounds<3>(nzm,nx+1,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
       int ib=i-1;
-      uuu(k,j,i+offx_uuu,icrm)= pp2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(k,j,ib+offx_m,icrm))) -
-                       pn2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,ib+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
+      uuu(k,j,i+offx_uuu,icrm)= pp2(uuu(k,j,i+offx_uuu,icrm))*min((real) 1.0,min(mx(k,j,i+offx_m,icrm), mn(k,j,ib+offx_m,icrm))) -
+                       pn2(uuu(k,j,i+offx_uuu,icrm))*min((real) 1.0,min(mx(k,j,ib+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
       if (i <= nx-1) {
         int kb=max(0,k-1);
-        www(k,j,i+offx_www,icrm)= pp2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(kb,j,i+offx_m,icrm))) -
-                         pn2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
+        www(k,j,i+offx_www,icrm)= pp2(www(k,j,i+offx_www,icrm))*min((real) 1.0,min(mx(k,j,i+offx_m,icrm), mn(kb,j,i+offx_m,icrm))) -
+                         pn2(www(k,j,i+offx_www,icrm))*min((real) 1.0,min(mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
 
         yakl::atomicAdd(flux(k,icrm), www(k,j,i+offx_www,icrm));
       }
@@ -385,7 +385,7 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
     //     especially  when such large numbers as
     //     hydrometeor concentrations are advected. The reason for negative values is
     //     most likely truncation error.
-    f(ind_f,k,j,i+offx_s,icrm)= max(0.0, f(ind_f,k,j,i+offx_s,icrm) - (uuu(k,j,i+1+offx_uuu,icrm)-uuu(k,j,i+offx_uuu,icrm) +
+    f(ind_f,k,j,i+offx_s,icrm)= max((real) 0.0, f(ind_f,k,j,i+offx_s,icrm) - (uuu(k,j,i+1+offx_uuu,icrm)-uuu(k,j,i+offx_uuu,icrm) +
                    (www(k+1,j,i+offx_www,icrm)-www(k,j,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
   });
 
@@ -464,10 +464,10 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
     int kb=max(0,k-1);
-    uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i-1+offx_s-2,icrm)+
-                    min(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
+    uuu(k,j,i,icrm)=max((real) 0.0,u(k,j,i,icrm))*f(ind_f,k,j,i-1+offx_s-2,icrm)+
+                    min((real) 0.0,u(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
     if (i <= nx+3) {
-      www(k,j,i,icrm)=max(0.0,w(k,j,i,icrm))*f(ind_f,kb,j,i+offx_s-2,icrm)+min(0.0,w(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
+      www(k,j,i,icrm)=max((real) 0.0,w(k,j,i,icrm))*f(ind_f,kb,j,i+offx_s-2,icrm)+min((real) 0.0,w(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
     }
     if (i == 1) {
       flux(ind_flux,k,icrm) = 0.0;
@@ -559,12 +559,12 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     //    for (int icrm=0; icrm<ncrms; icrm++) {
     parallel_for( SimpleBounds<3>(nzm,nx+1,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
       int ib=i-1;
-      uuu(k,j,i+offx_uuu,icrm)= pp2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(k,j,ib+offx_m,icrm))) -
-                                pn2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,ib+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
+      uuu(k,j,i+offx_uuu,icrm)= pp2(uuu(k,j,i+offx_uuu,icrm))*min((real) 1.0,min(mx(k,j,i+offx_m,icrm), mn(k,j,ib+offx_m,icrm))) -
+                                pn2(uuu(k,j,i+offx_uuu,icrm))*min((real) 1.0,min(mx(k,j,ib+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
       if (i <= nx-1) {
         int kb=max(0,k-1);
-        www(k,j,i+offx_www,icrm)= pp2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(kb,j,i+offx_m,icrm))) -
-                                  pn2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
+        www(k,j,i+offx_www,icrm)= pp2(www(k,j,i+offx_www,icrm))*min((real) 1.0,min(mx(k,j,i+offx_m,icrm), mn(kb,j,i+offx_m,icrm))) -
+                                  pn2(www(k,j,i+offx_www,icrm))*min((real) 1.0,min(mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
 
         yakl::atomicAdd(flux(ind_flux,k,icrm), www(k,j,i+offx_www,icrm));
       }
@@ -580,7 +580,7 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     //     especially  when such large numbers as
     //     hydrometeor concentrations are advected. The reason for negative values is
     //     most likely truncation error.
-    f(ind_f,k,j,i+offx_s,icrm)= max(0.0, f(ind_f,k,j,i+offx_s,icrm) - (uuu(k,j,i+1+offx_uuu,icrm)-uuu(k,j,i+offx_uuu,icrm) +
+    f(ind_f,k,j,i+offx_s,icrm)= max((real) 0.0, f(ind_f,k,j,i+offx_s,icrm) - (uuu(k,j,i+1+offx_uuu,icrm)-uuu(k,j,i+offx_uuu,icrm) +
                                 (www(k+1,j,i+offx_www,icrm)-www(k,j,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
   });
 
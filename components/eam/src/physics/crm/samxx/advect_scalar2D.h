@@ -19,10 +19,10 @@ YAKL_INLINE real across2(real x1, real a1, real a2) {
 }
 
 YAKL_INLINE real pp2(real y) {
-  return max(0.0,y);
+  return max((real) 0.0,y);
 }
 
 YAKL_INLINE real pn2(real y) {
-  return -min(0.0,y);
+  return -min((real) 0.0,y);
 }
 
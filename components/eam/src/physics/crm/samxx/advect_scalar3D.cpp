@@ -114,16 +114,16 @@ void advect_scalar3D(real4d &f, real2d &flux) {
   parallel_for( SimpleBounds<4>(nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int kb=max(0,k-1);
     if (j <= ny+3){
-      uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(k,j+offy_s-2,i-1+offx_s-2,icrm)+
-                      min(0.0,u(k,j,i,icrm))*f(k,j+offy_s-2,i+offx_s-2,icrm);
+      uuu(k,j,i,icrm)=max((real) 0.0,u(k,j,i,icrm))*f(k,j+offy_s-2,i-1+offx_s-2,icrm)+
+                      min((real) 0.0,u(k,j,i,icrm))*f(k,j+offy_s-2,i+offx_s-2,icrm);
     }
     if (i <= nx+3) {
-      vvv(k,j,i,icrm)=max(0.0,v(k,j,i,icrm))*f(k,j-1+offy_s-2,i+offx_s-2,icrm)+
-                      min(0.0,v(k,j,i,icrm))*f(k,j+offx_s-2,i+offy_s-2,icrm);
+      vvv(k,j,i,icrm)=max((real) 0.0,v(k,j,i,icrm))*f(k,j-1+offy_s-2,i+offx_s-2,icrm)+
+                      min((real) 0.0,v(k,j,i,icrm))*f(k,j+offx_s-2,i+offy_s-2,icrm);
     }
     if (i <= nx+3 && j <= ny+3) {
-      www(k,j,i,icrm)=max(0.0,w(k,j,i,icrm))*f(kb,j+offy_s-2,i+offx_s-2,icrm)+
-                      min(0.0,w(k,j,i,icrm))*f(k,j+offy_s-2,i+offx_s-2,icrm);
+      www(k,j,i,icrm)=max((real) 0.0,w(k,j,i,icrm))*f(kb,j+offy_s-2,i+offx_s-2,icrm)+
+                      min((real) 0.0,w(k,j,i,icrm))*f(k,j+offy_s-2,i+offx_s-2,icrm);
     }
     if (i == 0 && j == 0) {
       flux(k,icrm) = 0.0;
@@ -260,20 +260,20 @@ void advect_scalar3D(real4d &f, real2d &flux) {
       if (j <= ny-1) {
         int ib=i-1;
         uuu(k,j+offy_uuu,i+offx_uuu,icrm) = 
-              pp3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(k,j+offy_m,ib+offx_m,icrm)))
-             -pn3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min(1.0,min(mx(k,j+offy_m,ib+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
+              pp3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min((real) 1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(k,j+offy_m,ib+offx_m,icrm)))
+             -pn3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min((real) 1.0,min(mx(k,j+offy_m,ib+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
       }
       if (i <= nx-1) {
         int jb=j-1;
         vvv(k,j+offy_vvv,i+offx_vvv,icrm) =
-              pp3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(k,jb+offy_m,i+offx_m,icrm)))
-             -pn3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min(1.0,min(mx(k,jb+offy_m,i+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
+              pp3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min((real) 1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(k,jb+offy_m,i+offx_m,icrm)))
+             -pn3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min((real) 1.0,min(mx(k,jb+offy_m,i+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
       }
       if (i <= nx-1 && j <= ny-1) {
         int kb=max(0,k-1);
         www(k,j+offy_www,i+offx_www,icrm) =
-              pp3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(kb,j+offy_m,i+offx_m,icrm)))
-             -pn3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(kb,j+offy_m,i+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
+              pp3(www(k,j+offy_www,i+offx_www,icrm))*min((real) 1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(kb,j+offy_m,i+offx_m,icrm)))
+             -pn3(www(k,j+offy_www,i+offx_www,icrm))*min((real) 1.0,min(mx(kb,j+offy_m,i+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
         yakl::atomicAdd(flux(k,icrm),www(k,j+offy_www,i+offx_www,icrm));
       }
     });
@@ -290,7 +290,7 @@ void advect_scalar3D(real4d &f, real2d &flux) {
     //     most likely truncation error.
     int kc=k+1;
     f(k,j+offy_s,i+offx_s,icrm) = 
-         max(0.0,f(k,j+offy_s,i+offx_s,icrm) -(uuu(k,j+offy_uuu,i+offx_uuu+1,icrm)-uuu(k,j+offy_uuu,i+offx_uuu,icrm)+
+         max((real) 0.0,f(k,j+offy_s,i+offx_s,icrm) -(uuu(k,j+offy_uuu,i+offx_uuu+1,icrm)-uuu(k,j+offy_uuu,i+offx_uuu,icrm)+
                  vvv(k,j+offy_vvv+1,i+offx_vvv,icrm)-vvv(k,j+offy_vvv,i+offx_vvv,icrm)+(www(k+1,j+offy_www,i+offx_www,icrm)-
                  www(k,j+offy_www,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
   });
@@ -411,16 +411,16 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
   parallel_for( SimpleBounds<4>(nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int kb=max(0,k-1);
     if (j <= ny+3){
-      uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i-1+offx_s-2,icrm)+
-                      min(0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm);
+      uuu(k,j,i,icrm)=max((real) 0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i-1+offx_s-2,icrm)+
+                      min((real) 0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm);
     }
     if (i <= nx+3) {
-      vvv(k,j,i,icrm)=max(0.0,v(k,j,i,icrm))*f(ind_f,k,j-1+offy_s-2,i+offx_s-2,icrm)+
-                      min(0.0,v(k,j,i,icrm))*f(ind_f,k,j+offx_s-2,i+offy_s-2,icrm);
+      vvv(k,j,i,icrm)=max((real) 0.0,v(k,j,i,icrm))*f(ind_f,k,j-1+offy_s-2,i+offx_s-2,icrm)+
+                      min((real) 0.0,v(k,j,i,icrm))*f(ind_f,k,j+offx_s-2,i+offy_s-2,icrm);
     }
     if (i <= nx+3 && j <= ny+3) {
-      www(k,j,i,icrm)=max(0.0,w(k,j,i,icrm))*f(ind_f,kb,j+offy_s-2,i+offx_s-2,icrm)+
-                      min(0.0,w(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm);
+      www(k,j,i,icrm)=max((real) 0.0,w(k,j,i,icrm))*f(ind_f,kb,j+offy_s-2,i+offx_s-2,icrm)+
+                      min((real) 0.0,w(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm);
     }
     if (i == 0 && j == 0) {
       flux(k,icrm) = 0.0;
@@ -557,20 +557,20 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
       if (j <= ny-1) {
         int ib=i-1;
         uuu(k,j+offy_uuu,i+offx_uuu,icrm) = 
-              pp3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(k,j+offy_m,ib+offx_m,icrm)))
-             -pn3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min(1.0,min(mx(k,j+offy_m,ib+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
+              pp3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min((real) 1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(k,j+offy_m,ib+offx_m,icrm)))
+             -pn3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min((real) 1.0,min(mx(k,j+offy_m,ib+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
       }
       if (i <= nx-1) {
         int jb=j-1;
         vvv(k,j+offy_vvv,i+offx_vvv,icrm) =
-              pp3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(k,jb+offy_m,i+offx_m,icrm)))
-             -pn3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min(1.0,min(mx(k,jb+offy_m,i+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
+              pp3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min((real) 1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(k,jb+offy_m,i+offx_m,icrm)))
+             -pn3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min((real) 1.0,min(mx(k,jb+offy_m,i+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
       }
       if (i <= nx-1 && j <= ny-1) {
         int kb=max(0,k-1);
         www(k,j+offy_www,i+offx_www,icrm) =
-              pp3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(kb,j+offy_m,i+offx_m,icrm)))
-             -pn3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(kb,j+offy_m,i+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
+              pp3(www(k,j+offy_www,i+offx_www,icrm))*min((real) 1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(kb,j+offy_m,i+offx_m,icrm)))
+             -pn3(www(k,j+offy_www,i+offx_www,icrm))*min((real) 1.0,min(mx(kb,j+offy_m,i+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
         yakl::atomicAdd(flux(k,icrm),www(k,j+offy_www,i+offx_www,icrm));
       }
     });
@@ -587,7 +587,7 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
     //     most likely truncation error.
     int kc=k+1;
     f(ind_f,k,j+offy_s,i+offx_s,icrm) = 
-         max(0.0,f(ind_f,k,j+offy_s,i+offx_s,icrm) -(uuu(k,j+offy_uuu,i+offx_uuu+1,icrm)-uuu(k,j+offy_uuu,i+offx_uuu,icrm)+
+         max((real) 0.0,f(ind_f,k,j+offy_s,i+offx_s,icrm) -(uuu(k,j+offy_uuu,i+offx_uuu+1,icrm)-uuu(k,j+offy_uuu,i+offx_uuu,icrm)+
                  vvv(k,j+offy_vvv+1,i+offx_vvv,icrm)-vvv(k,j+offy_vvv,i+offx_vvv,icrm)+(www(k+1,j+offy_www,i+offx_www,icrm)-
                  www(k,j+offy_www,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
   });
@@ -710,16 +710,16 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   parallel_for( SimpleBounds<4>(nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int kb=max(0,k-1);
     if (j <= ny+3){
-      uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i-1+offx_s-2,icrm)+
-                      min(0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm);
+      uuu(k,j,i,icrm)=max((real) 0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i-1+offx_s-2,icrm)+
+                      min((real) 0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm);
     }
     if (i <= nx+3) {
-      vvv(k,j,i,icrm)=max(0.0,v(k,j,i,icrm))*f(ind_f,k,j-1+offy_s-2,i+offx_s-2,icrm)+
-                      min(0.0,v(k,j,i,icrm))*f(ind_f,k,j+offx_s-2,i+offy_s-2,icrm);
+      vvv(k,j,i,icrm)=max((real) 0.0,v(k,j,i,icrm))*f(ind_f,k,j-1+offy_s-2,i+offx_s-2,icrm)+
+                      min((real) 0.0,v(k,j,i,icrm))*f(ind_f,k,j+offx_s-2,i+offy_s-2,icrm);
     }
     if (i <= nx+3 && j <= ny+3) {
-      www(k,j,i,icrm)=max(0.0,w(k,j,i,icrm))*f(ind_f,kb,j+offy_s-2,i+offx_s-2,icrm)+
-                      min(0.0,w(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm);
+      www(k,j,i,icrm)=max((real) 0.0,w(k,j,i,icrm))*f(ind_f,kb,j+offy_s-2,i+offx_s-2,icrm)+
+                      min((real) 0.0,w(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm);
     }
     if (i == 0 && j == 0) {
       flux(ind_flux,k,icrm) = 0.0;
@@ -883,25 +883,25 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       if (j <= ny-1) {
         int ib=i-1;
         uuu(k,j+offy_uuu,i+offx_uuu,icrm) = 
-              pp3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), 
+              pp3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min((real) 1.0,min(mx(k,j+offy_m,i+offx_m,icrm), 
               mn(k,j+offy_m,ib+offx_m,icrm)))
-             -pn3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min(1.0,min(mx(k,j+offy_m,ib+offx_m,icrm),
+             -pn3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min((real) 1.0,min(mx(k,j+offy_m,ib+offx_m,icrm),
              mn(k,j+offy_m,i+offx_m,icrm)));
       }
       if (i <= nx-1) {
         int jb=j-1;
         vvv(k,j+offy_vvv,i+offx_vvv,icrm) =
-              pp3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), 
+              pp3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min((real) 1.0,min(mx(k,j+offy_m,i+offx_m,icrm), 
               mn(k,jb+offy_m,i+offx_m,icrm)))
-             -pn3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min(1.0,min(mx(k,jb+offy_m,i+offx_m,icrm),
+             -pn3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min((real) 1.0,min(mx(k,jb+offy_m,i+offx_m,icrm),
              mn(k,j+offy_m,i+offx_m,icrm)));
       }
       if (i <= nx-1 && j <= ny-1) {
         int kb=max(0,k-1);
         www(k,j+offy_www,i+offx_www,icrm) =
-              pp3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), 
+              pp3(www(k,j+offy_www,i+offx_www,icrm))*min((real) 1.0,min(mx(k,j+offy_m,i+offx_m,icrm), 
               mn(kb,j+offy_m,i+offx_m,icrm)))
-             -pn3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(kb,j+offy_m,i+offx_m,icrm),
+             -pn3(www(k,j+offy_www,i+offx_www,icrm))*min((real) 1.0,min(mx(kb,j+offy_m,i+offx_m,icrm),
              mn(k,j+offy_m,i+offx_m,icrm)));
         yakl::atomicAdd(flux(ind_flux,k,icrm),www(k,j+offy_www,i+offx_www,icrm));
       }
@@ -919,7 +919,7 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     //     most likely truncation error.
     int kc=k+1;
     f(ind_f,k,j+offy_s,i+offx_s,icrm) = 
-         max(0.0,f(ind_f,k,j+offy_s,i+offx_s,icrm) -(uuu(k,j+offy_uuu,i+offx_uuu+1,icrm)-
+         max((real) 0.0,f(ind_f,k,j+offy_s,i+offx_s,icrm) -(uuu(k,j+offy_uuu,i+offx_uuu+1,icrm)-
                  uuu(k,j+offy_uuu,i+offx_uuu,icrm)+
                  vvv(k,j+offy_vvv+1,i+offx_vvv,icrm)-vvv(k,j+offy_vvv,i+offx_vvv,icrm)+
                  (www(k+1,j+offy_www,i+offx_www,icrm)-
@@ -927,3 +927,357 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   });
 
 }
+
+void advect_scalar3D(real5d &f, int nfld, adv_fields const &ind_f, real3d &flux, adv_fields const &ind_flux) {
+  YAKL_SCOPE( dowallx  , ::dowallx);
+  YAKL_SCOPE( dowally  , ::dowally);
+  YAKL_SCOPE( rank     , ::rank);
+  YAKL_SCOPE( u        , ::u);
+  YAKL_SCOPE( v        , ::v);
+  YAKL_SCOPE( w        , ::w);
+  YAKL_SCOPE( rho      , ::rho);
+  YAKL_SCOPE( adz      , ::adz);
+  YAKL_SCOPE( rhow     , ::rhow);
+  YAKL_SCOPE( ncrms    , ::ncrms);
+
+  bool constexpr nonos    = true;
+  real constexpr eps      = 1.0e-10;
+  int  constexpr offx_m   = 1;
+  int  constexpr offy_m   = 1;
+  int  constexpr offx_uuu = 2;
+  int  constexpr offy_uuu = 2;
+  int  constexpr offx_vvv = 2;
+  int  constexpr offy_vvv = 2;
+  int  constexpr offx_www = 2;
+  int  constexpr offy_www = 2;
+
+  ArenaScope arena_scope;
+  real5d mx    = arena_array<real5d>("mx"   ,nfld,nzm,ny+2,nx+2,ncrms);
+  real5d mn    = arena_array<real5d>("mn"   ,nfld,nzm,ny+2,nx+2,ncrms);
+  real5d uuu   = arena_array<real5d>("uuu"  ,nfld,nzm,ny+4,nx+5,ncrms);
+  real5d vvv   = arena_array<real5d>("vvv"  ,nfld,nzm,ny+5,nx+4,ncrms);
+  real5d www   = arena_array<real5d>("www"  ,nfld,nz ,ny+4,nx+4,ncrms);
+  real2d iadz  = arena_array<real2d>("iadz" ,nzm,ncrms);
+  real2d irho  = arena_array<real2d>("irho" ,nzm,ncrms);
+  real2d irhow = arena_array<real2d>("irhow",nzm,ncrms);
+
+  // for (int j=0; j<ny+4; j++) {
+  //   for (int i=0; i<nx+4; i++) {
+  //     for(int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(ny+4,nx+4,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    for (int l=0; l<nfld; l++) {
+      www(l,nz-1,j,i,icrm)=0.0;
+    }
+  });
+
+  if (dowallx) {
+    if (rank%nsubdomains_x == 0) {
+      // for (int k=0; k<nzm; k++) {
+      //   for (int j=0; j<dimy_u; j++) {
+      //     for (int i=0; i<1-dimx1_u+1; i++) {
+      //       for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<4>(nzm,dimy_u,1-dimx1_u+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+        u(k,j,i,icrm) = 0.0;
+      });
+    }
+    if (rank%nsubdomains_x == nsubdomains_x-1) {
+      // for (int k=0; k<nzm; k++) {
+      //   for (int j=0; j<dimy_u; j++) {
+      //     for (int i=0; i<dimx2_u-(nx+1)+1; i++) {
+      //       for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<4>(nzm,dimy_u,dimx2_u-(nx+1)+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+        int iInd = i+(nx+2);
+        u(k,j,iInd,icrm) = 0.0;
+      });
+    }
+  }
+
+  if (dowally) {
+    if (rank < nsubdomains_x) {
+      // for (int k=0; k<nzm; k++) {
+      //   for (int j=0; j<1-dimy1_v+1; j++) {
+      //     for (int i=0; i<dimx_v; i++) {
+      //       for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<4>(nzm,1-dimy1_v+1,dimx_v,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+        v(k,j,i,icrm) = 0.0;
+      });
+    }
+    if (rank > nsubdomains-nsubdomains_x-1) {
+      // for (int k=0; k<nzm; k++) {
+      //   for (int j=0; j<dimy2_v-(ny+1)+1; j++) {
+      //     for (int i=0; i<dimx_v; i++) {
+      //       for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<4>(nzm,dimy2_v-(ny+1)+1,dimx_v,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+        int jInd = j+(ny+2);
+        v(k,jInd,i,icrm) = 0.0;
+      });
+    }
+  }
+
+  if (nonos) {
+    // for (int k=0; k<nzm; k++) {
+    //   for (int j=0; j<ny+2; j++) {
+    //     for (int i=0; i<nx+2; i++) {
+    //       for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      int kc=min(nzm-1,k+1);
+      int kb=max(0,k-1);
+      int jb=j-1;
+      int jc=j+1;
+      int ib=i-1;
+      int ic=i+1;
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l);
+        mx(l,k,j,i,icrm) = 
+             max(f(n,k,j+offy_s-1,ib+offx_s-1,icrm),max(f(n,k,j+offy_s-1,ic+offx_s-1,icrm),
+             max(f(n,k,jb+offy_s-1,i+offx_s-1,icrm),max(f(n,k,jc+offy_s-1,i+offx_s-1,icrm),
+             max(f(n,kb,j+offy_s-1,i+offx_s-1,icrm),max(f(n,kc,j+offy_s-1,i+offx_s-1,icrm),f(n,k,j+offy_s-1,i+offx_s-1,icrm)))))));
+        mn(l,k,j,i,icrm) = 
+             min(f(n,k,j+offy_s-1,ib+offx_s-1,icrm),min(f(n,k,j+offy_s-1,ic+offx_s-1,icrm),
+             min(f(n,k,jb+offy_s-1,i+offx_s-1,icrm),min(f(n,k,jc+offy_s-1,i+offx_s-1,icrm),
+             min(f(n,kb,j+offy_s-1,i+offx_s-1,icrm),min(f(n,kc,j+offy_s-1,i+offx_s-1,icrm),f(n,k,j+offy_s-1,i+offx_s-1,icrm)))))));
+      }
+    });
+  } 
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny+5; j++) {
+  //     for (int i=0; i<nx+5; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    int kb=max(0,k-1);
+    if (j <= ny+3){
+      real up = max((real) 0.0,u(k,j,i,icrm));
+      real um = min((real) 0.0,u(k,j,i,icrm));
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l);
+        uuu(l,k,j,i,icrm)=up*f(n,k,j+offy_s-2,i-1+offx_s-2,icrm)+um*f(n,k,j+offy_s-2,i+offx_s-2,icrm);
+      }
+    }
+    if (i <= nx+3) {
+      real vp = max((real) 0.0,v(k,j,i,icrm));
+      real vm = min((real) 0.0,v(k,j,i,icrm));
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l);
+        vvv(l,k,j,i,icrm)=vp*f(n,k,j-1+offy_s-2,i+offx_s-2,icrm)+vm*f(n,k,j+offy_s-2,i+offx_s-2,icrm);
+      }
+    }
+    if (i <= nx+3 && j <= ny+3) {
+      real wp = max((real) 0.0,w(k,j,i,icrm));
+      real wm = min((real) 0.0,w(k,j,i,icrm));
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l);
+        www(l,k,j,i,icrm)=wp*f(n,kb,j+offy_s-2,i+offx_s-2,icrm)+wm*f(n,k,j+offy_s-2,i+offx_s-2,icrm);
+      }
+    }
+    if (i == 0 && j == 0) {
+      for (int l=0; l<nfld; l++) {
+        flux(ind_flux(l),k,icrm) = 0.0;
+      }
+    }
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    irho(k,icrm) = 1.0/rho(k,icrm);
+    iadz(k,icrm) = 1.0/adz(k,icrm);
+    irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny+4; j++) {
+  //     for (int i=0; i<nx+4; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    bool interior = i >= 2 && i <= nx+1 && j >= 2 && j <= ny+1;
+    real irho_k = irho(k,icrm);
+    real iadz_k = iadz(k,icrm);
+    for (int l=0; l<nfld; l++) {
+      int n = ind_f(l);
+      if (interior) {
+        yakl::atomicAdd(flux(ind_flux(l),k,icrm),www(l,k,j,i,icrm));
+      }
+      f(n,k,j+offy_s-2,i+offx_s-2,icrm)=f(n,k,j+offy_s-2,i+offx_s-2,icrm)-( uuu(l,k,j,i+1,icrm)-uuu(l,k,j,i,icrm) +
+                                        vvv(l,k,j+1,i,icrm)-vvv(l,k,j,i,icrm)
+                                        +(www(l,k+1,j,i,icrm)-www(l,k,j,i,icrm) )*iadz_k)*irho_k;
+    }
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny+3; j++) {
+  //     for (int i=0; i<nx+3; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny+3,nx+3,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    real irho_k = irho(k,icrm);
+    if (j <= ny+1) {
+      int kc=min(nzm-1,k+1);
+      int kb=max(0,k-1);
+      real dd=2.0/(kc-kb)/adz(k,icrm);
+      int jb=j-1;
+      int jc=j+1;
+      int ib=i-1;
+      real uc   = u(k,j+offy_u-1,i+offx_u-1,icrm);
+      real vsum = v(k,j+offy_v-1,ib+offx_v-1,icrm)+v(k,jc+offy_v-1,ib+offx_v-1,icrm)+
+                  v(k,jc+offy_v-1,i+offx_v-1,icrm)+v(k,j+offy_v-1,i+offx_v-1,icrm);
+      real wsum = w(k,j+offy_w-1,ib+offx_w-1,icrm)+w(kc,j+offy_w-1,ib+offx_w-1,icrm)+
+                  w(k,j+offy_w-1,i+offx_w-1,icrm)+w(kc,j+offy_w-1,i+offx_w-1,icrm);
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l);
+        uuu(l,k,j+offy_uuu-1,i+offx_uuu-1,icrm) = 
+             andiff(f(n,k,j+offy_s-1,ib+offx_s-1,icrm),f(n,k,j+offy_s-1,i+offx_s-1,icrm),uc,irho_k)-
+            (across(f(n,k,jc+offy_s-1,ib+offx_s-1,icrm)+f(n,k,jc+offy_s-1,i+offx_s-1,icrm)-f(n,k,jb+offy_s-1,ib+offx_s-1,icrm)-
+                    f(n,k,jb+offy_s-1,i+offx_s-1,icrm),uc,vsum)+
+             across(dd*(f(n,kc,j+offy_s-1,ib+offx_s-1,icrm)+f(n,kc,j+offy_s-1,i+offx_s-1,icrm)-f(n,kb,j+offy_s-1,ib+offx_s-1,icrm)-
+                    f(n,kb,j+offy_s-1,i+offx_s-1,icrm)),uc,wsum)) *irho_k;
+      }
+    }
+    if (i <= nx+1) {
+      int kc=min(nzm-1,k+1);
+      int kb=max(0,k-1);
+      real dd=2.0/(kc-kb)/adz(k,icrm);
+      int jb=j-1;
+      int ib=i-1;
+      int ic=i+1;
+      real vc   = v(k,j+offy_v-1,i+offx_v-1,icrm);
+      real usum = u(k,jb+offy_u-1,i+offx_u-1,icrm)+u(k,j+offy_u-1,i+offx_u-1,icrm)+
+                  u(k,j+offy_u-1,ic+offx_u-1,icrm)+u(k,jb+offy_u-1,ic+offx_u-1,icrm);
+      real wsum = w(k,jb+offy_w-1,i+offx_w-1,icrm)+w(k,j+offy_w-1,i+offx_w-1,icrm)+
+                  w(kc,j+offy_w-1,i+offx_w-1,icrm)+w(kc,jb+offy_w-1,i+offx_w-1,icrm);
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l);
+        vvv(l,k,j+offy_vvv-1,i+offx_vvv-1,icrm) = 
+             andiff(f(n,k,jb+offy_s-1,i+offx_s-1,icrm),f(n,k,j+offy_s-1,i+offx_s-1,icrm),vc,irho_k)-
+             (across(f(n,k,jb+offy_s-1,ic+offx_s-1,icrm)+f(n,k,j+offy_s-1,ic+offx_s-1,icrm)-f(n,k,jb+offy_s-1,ib+offx_s-1,icrm)-
+                     f(n,k,j+offy_s-1,ib+offx_s-1,icrm),vc,usum)+
+              across(dd*(f(n,kc,jb+offy_s-1,i+offx_s-1,icrm)+f(n,kc,j+offy_s-1,i+offx_s-1,icrm)-f(n,kb,jb+offy_s-1,i+offx_s-1,icrm)-
+                     f(n,kb,j+offy_s-1,i+offx_s-1,icrm)),vc,wsum)) *irho_k;
+      }
+    }
+    if (i <= nx+1 && j <= ny+1) {
+      int kb=max(0,k-1);
+      int jb=j-1;
+      int jc=j+1;
+      int ib=i-1;
+      int ic=i+1;
+      real irhow_k = irhow(k,icrm);
+      real wc   = w(k,j+offy_w-1,i+offx_w-1,icrm);
+      real usum = u(kb,j+offy_u-1,i+offx_u-1,icrm)+u(k,j+offy_u-1,i+offx_u-1,icrm)+
+                  u(k,j+offy_u-1,ic+offx_u-1,icrm)+u(kb,j+offy_u-1,ic+offx_u-1,icrm);
+      real vsum = v(kb,j+offy_v-1,i+offx_v-1,icrm)+v(kb,jc+offy_v-1,i+offx_v-1,icrm)+
+                  v(k,jc+offy_v-1,i+offx_v-1,icrm)+v(k,j+offy_v-1,i+offx_v-1,icrm);
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l);
+        www(l,k,j+offy_www-1,i+offx_www-1,icrm) = 
+             andiff(f(n,kb,j+offy_s-1,i+offx_s-1,icrm),f(n,k,j+offy_s-1,i+offx_s-1,icrm),wc,irhow_k)-
+            (across(f(n,kb,j+offy_s-1,ic+offx_s-1,icrm)+f(n,k,j+offy_s-1,ic+offx_s-1,icrm)-f(n,kb,j+offy_s-1,ib+offx_s-1,icrm)-
+                    f(n,k,j+offy_s-1,ib+offx_s-1,icrm),wc,usum)+
+             across(f(n,k,jc+offy_s-1,i+offx_s-1,icrm)+f(n,kb,jc+offy_s-1,i+offx_s-1,icrm)-f(n,k,jb+offy_s-1,i+offx_s-1,icrm)-
+                    f(n,kb,jb+offy_s-1,i+offx_s-1,icrm),wc,vsum)) *irho_k;
+      }
+    }
+  });
+
+  // for (int j=0; j<ny+4; j++) {
+  //   for (int i=0; i<nx+4; i++) {
+  //     for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(ny+4,nx+4,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    for (int l=0; l<nfld; l++) {
+      www(l,0,j,i,icrm) = 0.0;
+    }
+  });
+
+  if (nonos) {
+    // for (int k=0; k<nzm; k++) {
+    //   for (int j=0; j<ny+2; j++) {
+    //     for (int i=0; i<nx+2; i++) {
+    //       for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      int kc=min(nzm-1,k+1);
+      int kb=max(0,k-1);
+      int jb=j-1;
+      int jc=j+1;
+      int ib=i-1;
+      int ic=i+1;
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l);
+        mx(l,k,j,i,icrm) = 
+            max(f(n,k,j+offy_s-1,ib+offx_s-1,icrm),max(f(n,k,j+offy_s-1,ic+offx_s-1,icrm),max(f(n,k,jb+offy_s-1,i+offx_s-1,icrm),
+            max(f(n,k,jc+offy_s-1,i+offx_s-1,icrm),max(f(n,kb,j+offy_s-1,i+offx_s-1,icrm),max(f(n,kc,j+offy_s-1,i+offx_s-1,icrm),
+            max(f(n,k,j+offy_s-1,i+offx_s-1,icrm),mx(l,k,j,i,icrm))))))));
+        mn(l,k,j,i,icrm) = 
+            min(f(n,k,j+offy_s-1,ib+offx_s-1,icrm),min(f(n,k,j+offy_s-1,ic+offx_s-1,icrm),min(f(n,k,jb+offy_s-1,i+offx_s-1,icrm),
+            min(f(n,k,jc+offy_s-1,i+offx_s-1,icrm),min(f(n,kb,j+offy_s-1,i+offx_s-1,icrm),min(f(n,kc,j+offy_s-1,i+offx_s-1,icrm),
+            min(f(n,k,j+offy_s-1,i+offx_s-1,icrm),mn(l,k,j,i,icrm))))))));
+      }
+    });
+
+    // for (int k=0; k<nzm; k++) {
+    //   for (int j=0; j<ny+2; j++) {
+    //     for (int i=0; i<nx+2; i++) {
+    //       for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      int kc=min(nzm-1,k+1);
+      int jc=j+1;
+      int ic=i+1;
+      real rho_k  = rho(k,icrm);
+      real iadz_k = iadz(k,icrm);
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l);
+        mx(l,k,j,i,icrm)=rho_k*(mx(l,k,j,i,icrm)-f(n,k,j+offy_s-1,i+offx_s-1,icrm))/
+                  ( pn3(uuu(l,k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pp3(uuu(l,k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
+                    pn3(vvv(l,k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pp3(vvv(l,k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
+                   (pn3(www(l,kc,j+offy_www-1,i+offx_www-1,icrm)) + pp3(www(l,k,j+offy_www-1,i+offx_www-1,icrm)))*iadz_k+eps);
+        mn(l,k,j,i,icrm)=rho_k*(f(n,k,j+offy_s-1,i+offx_s-1,icrm)-mn(l,k,j,i,icrm))/
+                  ( pp3(uuu(l,k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pn3(uuu(l,k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
+                    pp3(vvv(l,k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pn3(vvv(l,k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
+                   (pp3(www(l,kc,j+offy_www-1,i+offx_www-1,icrm)) + pn3(www(l,k,j+offy_www-1,i+offx_www-1,icrm)))*iadz_k+eps);
+      }
+    });
+
+    // for (int k=0; k<nzm; k++) {
+    //   for (int j=0; j<ny+1; j++) {
+    //     for (int i=0; i<nx+1; i++) {
+    //       for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(nzm,ny+1,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      for (int l=0; l<nfld; l++) {
+        if (j <= ny-1) {
+          int ib=i-1;
+          uuu(l,k,j+offy_uuu,i+offx_uuu,icrm) = 
+                pp3(uuu(l,k,j+offy_uuu,i+offx_uuu,icrm))*min((real) 1.0,min(mx(l,k,j+offy_m,i+offx_m,icrm), mn(l,k,j+offy_m,ib+offx_m,icrm)))
+               -pn3(uuu(l,k,j+offy_uuu,i+offx_uuu,icrm))*min((real) 1.0,min(mx(l,k,j+offy_m,ib+offx_m,icrm),mn(l,k,j+offy_m,i+offx_m,icrm)));
+        }
+        if (i <= nx-1) {
+          int jb=j-1;
+          vvv(l,k,j+offy_vvv,i+offx_vvv,icrm) =
+                pp3(vvv(l,k,j+offy_vvv,i+offx_vvv,icrm))*min((real) 1.0,min(mx(l,k,j+offy_m,i+offx_m,icrm), mn(l,k,jb+offy_m,i+offx_m,icrm)))
+               -pn3(vvv(l,k,j+offy_vvv,i+offx_vvv,icrm))*min((real) 1.0,min(mx(l,k,jb+offy_m,i+offx_m,icrm),mn(l,k,j+offy_m,i+offx_m,icrm)));
+        }
+        if (i <= nx-1 && j <= ny-1) {
+          int kb=max(0,k-1);
+          www(l,k,j+offy_www,i+offx_www,icrm) =
+                pp3(www(l,k,j+offy_www,i+offx_www,icrm))*min((real) 1.0,min(mx(l,k,j+offy_m,i+offx_m,icrm), mn(l,kb,j+offy_m,i+offx_m,icrm)))
+               -pn3(www(l,k,j+offy_www,i+offx_www,icrm))*min((real) 1.0,min(mx(l,kb,j+offy_m,i+offx_m,icrm),mn(l,k,j+offy_m,i+offx_m,icrm)));
+          yakl::atomicAdd(flux(ind_flux(l),k,icrm),www(l,k,j+offy_www,i+offx_www,icrm));
+        }
+      }
+    });
+  }
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny; j++) {
+  //     for (int i=0; i<nx; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    real irho_k = irho(k,icrm);
+    real iadz_k = iadz(k,icrm);
+    for (int l=0; l<nfld; l++) {
+      int n = ind_f(l);
+      f(n,k,j+offy_s,i+offx_s,icrm) = 
+           max((real) 0.0,f(n,k,j+offy_s,i+offx_s,icrm) -(uuu(l,k,j+offy_uuu,i+offx_uuu+1,icrm)-uuu(l,k,j+offy_uuu,i+offx_uuu,icrm)+
+                   vvv(l,k,j+offy_vvv+1,i+offx_vvv,icrm)-vvv(l,k,j+offy_vvv,i+offx_vvv,icrm)+(www(l,k+1,j+offy_www,i+offx_www,icrm)-
+                   www(l,k,j+offy_www,i+offx_www,icrm))*iadz_k)*irho_k);
+    }
+  });
+
+}
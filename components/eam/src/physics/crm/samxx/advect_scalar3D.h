@@ -3,6 +3,13 @@
 
 #include "samxx_const.h"
 #include "vars.h"
+#include "arena.h"
+
+// Field index list for the multi-field overloads, used for micro_field. All
+// selected prognostics are advected in a single set of passes that load the
+// velocity stencil once per grid point and loop over the fields innermost.
+int constexpr nadv_fields_max = nmicro_fields;
+typedef SArray<int,1,nadv_fields_max> adv_fields;
 
 void advect_scalar3D(real4d &f, real2d &flux);
 
@@ -10,6 +17,8 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux);
 
 void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux);
 
+void advect_scalar3D(real5d &f, int nfld, adv_fields const &ind_f, real3d &flux, adv_fields const &ind_flux);
+
 YAKL_INLINE real andiff(real x1, real x2, real a, real b) {
   return (abs(a)-a*a*b)*0.5*(x2-x1);
 }
@@ -19,10 +28,10 @@ YAKL_INLINE real across(real x1, real a1, real a2) {
 }
 
 YAKL_INLINE real pp3(real y) {
-  return max(0.0,y);
+  return max((real) 0.0,y);
 }
 
 YAKL_INLINE real pn3(real y) {
-  return -min(0.0,y);
+  return -min((real) 0.0,y);
 }
 
@@ -0,0 +1,80 @@
+
+#include "arena.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+  // Allocations are rounded up to this many reals (128 bytes for double).
+  size_t constexpr arena_align = 16;
+  // Capacity, in 3D fields of the largest temporary shape and in column fields.
+  size_t constexpr arena_nfield3d = 16;
+  size_t constexpr arena_nfield1d = 16;
+
+  real1d arena_buf;
+  size_t arena_cap       = 0;
+  size_t arena_top       = 0;
+  size_t arena_highwater = 0;
+  size_t arena_noverflow = 0;
+  size_t arena_reported  = 0;
+}
+
+
+void arena_allocate() {
+  size_t n3d = static_cast<size_t>(nz) * (ny+2) * (nx+2) * ncrms;
+  size_t n1d = static_cast<size_t>(nz) * ncrms;
+  size_t cap = arena_nfield3d*n3d + arena_nfield1d*n1d;
+  cap = (cap + arena_align - 1) / arena_align * arena_align;
+  if (cap > arena_cap) {
+    arena_buf = real1d();
+    arena_buf = real1d("samxx_arena", cap);
+    arena_cap = cap;
+  }
+  arena_top       = 0;
+  arena_noverflow = 0;
+}
+
+
+void arena_finalize() {
+  if (gcm_masterproc && (arena_highwater > arena_reported || arena_noverflow > 0)) {
+    std::cout << "samxx arena: high-water mark " << arena_highwater << " of " << arena_cap
+              << " reals; " << arena_noverflow << " allocations did not fit" << std::endl;
+  }
+  arena_reported = std::max(arena_reported, arena_highwater);
+  arena_top = 0;
+}
+
+
+extern "C" void crm_arena_free() {
+  arena_buf = real1d();
+  arena_cap = 0;
+  arena_top = 0;
+}
+
+
+void arena_reset() {
+  arena_top = 0;
+}
+
+
+real *arena_alloc(size_t n) {
+  size_t nalloc = (n + arena_align - 1) / arena_align * arena_align;
+  if (arena_top + nalloc > arena_cap) {
+    arena_noverflow++;
+    return nullptr;
+  }
+  real *ptr = arena_buf.data() + arena_top;
+  arena_top += nalloc;
+  arena_highwater = std::max(arena_highwater, arena_top);
+  return ptr;
+}
+
+
+size_t arena_mark() {
+  return arena_top;
+}
+
+
+void arena_release(size_t mark) {
+  arena_top = std::min(arena_top, mark);
+}
+
@@ -0,0 +1,57 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include "vars.h"
+
+// Stack-style arena for the per-call temporaries of the CRM time step.
+//
+// One device buffer lives for the whole run. allocate() grows it only when a
+// crm() call has more CRMs than any earlier one. Routines open an ArenaScope
+// and draw their temporaries from the arena with arena_array; the scope
+// releases them on exit, so the arena holds at most one call chain's
+// temporaries at a time. Kernels are stream ordered, so memory released by one
+// routine can be reused by the next without a fence. A request that does not
+// fit falls back to a regular YAKL allocation and is counted, and finalize()
+// reports a new high-water mark or overflow on the GCM master task.
+
+// Called at the start of each crm() call.
+void arena_allocate();
+
+// Called at the end of each crm() call. Keeps the buffer.
+void arena_finalize();
+
+// Free the buffer. Called once at the end of the run, before YAKL finalizes.
+extern "C" void crm_arena_free();
+
+// Release everything. Called at the top of each timeloop iteration.
+void arena_reset();
+
+// Returns nullptr if n reals do not fit.
+real *arena_alloc(size_t n);
+
+size_t arena_mark();
+
+void arena_release(size_t mark);
+
+
+class ArenaScope {
+public:
+  ArenaScope() : mark(arena_mark()) {}
+  ~ArenaScope() { arena_release(mark); }
+  ArenaScope(ArenaScope const &) = delete;
+  ArenaScope &operator=(ArenaScope const &) = delete;
+private:
+  size_t mark;
+};
+
+
+template <class T, class... Dims>
+T arena_array(char const *label, Dims... dims) {
+  size_t n = 1;
+  for (size_t d : {static_cast<size_t>(dims)...}) { n *= d; }
+  real *ptr = arena_alloc(n);
+  if (ptr == nullptr) { return T(label, dims...); }
+  return T(label, ptr, dims...);
+}
+
@@ -21,7 +21,7 @@ void cloud(real5d &q, int ind_q, real5d &qp, int ind_qp) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    q(ind_q,k,j+offy_s,i+offx_s,icrm)=max(0.0,q(ind_q,k,j+offy_s,i+offx_s,icrm));
+    q(ind_q,k,j+offy_s,i+offx_s,icrm)=max((real) 0.0,q(ind_q,k,j+offy_s,i+offx_s,icrm));
     // Initial guess for temperature assuming no cloud water/ice:
     tabs(k,j,i,icrm) = t(k,j+offy_s,i+offx_s,icrm)-gamaz(k,icrm);
     real tabs1=(tabs(k,j,i,icrm)+fac1*qp(ind_qp,k,j+offy_s,i+offx_s,icrm))/
@@ -106,13 +106,13 @@ void cloud(real5d &q, int ind_q, real5d &qp, int ind_qp) {
         tabs1=tabs1+dtabs;
       } while(abs(dtabs) > 0.01 && niter < 10);
       qsatt = qsatt + dqsat * dtabs;
-      qn(k,j,i,icrm) = max(0.0,q(ind_q,k,j+offy_s,i+offx_s,icrm)-qsatt);
+      qn(k,j,i,icrm) = max((real) 0.0,q(ind_q,k,j+offy_s,i+offx_s,icrm)-qsatt);
     }
     else {
       qn(k,j,i,icrm) = 0.0;
     }
     tabs(k,j,i,icrm) = tabs1;
-    qp(ind_qp,k,j+offy_s,i+offx_s,icrm) = max(0.0,qp(ind_qp,k,j+offy_s,i+offx_s,icrm)); // just in case
+    qp(ind_qp,k,j+offy_s,i+offx_s,icrm) = max((real) 0.0,qp(ind_qp,k,j+offy_s,i+offx_s,icrm)); // just in case
   });
 
 }
@@ -21,7 +21,7 @@ YAKL_INLINE real diag_ustar(real z, real bflx, real wnd, real z0) {
   if (bflx != 0.0) {
     for (int iterate = 0; iterate < 8; iterate++) {
       real rlmo = -bflx * vonk/(ustar*ustar*ustar + eps);
-      real zeta = min(1.0,z*rlmo);
+      real zeta = min((real) 1.0,z*rlmo);
       if (zeta>0.0) {
         ustar = vonk*wnd / (lnz+am*zeta);
       } else {
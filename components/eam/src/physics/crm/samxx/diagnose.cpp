@@ -42,6 +42,7 @@ void diagnose() {
 
   real coef = 1.0/( (real) nx * (real) ny );
 
+#ifndef CRM_SINGLE_PRECISION
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
@@ -92,14 +93,45 @@ void diagnose() {
     qp0  (k,icrm)=qp0  (k,icrm)*coef;
     p0   (k,icrm)=p0   (k,icrm)*coef;
   });
+#else
+  double3d mean_sum("mean_sum",8,nzm,ncrms);
+  yakl::memset(mean_sum,0.);
 
+  // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny; j++) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(ny,nx,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
-    usfc_xy(j,i,icrm) = usfc_xy(j,i,icrm) + u(0,j+offy_s,i+offx_s,icrm)*dtfactor;
-    vsfc_xy(j,i,icrm) = vsfc_xy(j,i,icrm) + v(0,j+offy_s,i+offx_s,icrm)*dtfactor;
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    tabs(k,j,i,icrm) = t(k,j+offy_s,i+offx_s,icrm)-gamaz(k,icrm)+ fac_cond *
+                       (qcl(k,j,i,icrm)+qpl(k,j,i,icrm)) + fac_sub *(qci(k,j,i,icrm) + qpi(k,j,i,icrm));
+    yakl::atomicAdd(mean_sum(0,k,icrm),(double) u(k,j+offy_u,i+offx_u,icrm));
+    yakl::atomicAdd(mean_sum(1,k,icrm),(double) v(k,j+offy_v,i+offx_v,icrm));
+    yakl::atomicAdd(mean_sum(2,k,icrm),(double) p(k,j+offy_p,i+offx_p,icrm));
+    yakl::atomicAdd(mean_sum(3,k,icrm),(double) t(k,j+offy_s,i+offx_s,icrm));
+    yakl::atomicAdd(mean_sum(4,k,icrm),(double) tabs(k,j,i,icrm));
+    real tmp = qv(k,j,i,icrm)+qcl(k,j,i,icrm)+qci(k,j,i,icrm);
+    yakl::atomicAdd(mean_sum(5,k,icrm),(double) tmp);
+    tmp = qcl(k,j,i,icrm) + qci(k,j,i,icrm);
+    yakl::atomicAdd(mean_sum(6,k,icrm),(double) tmp);
+    tmp = qpl(k,j,i,icrm) + qpi(k,j,i,icrm);
+    yakl::atomicAdd(mean_sum(7,k,icrm),(double) tmp);
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    t01  (k,icrm) = tabs0(k,icrm);
+    q01  (k,icrm) = q0   (k,icrm);
+    u0   (k,icrm) = mean_sum(0,k,icrm)*coef;
+    v0   (k,icrm) = mean_sum(1,k,icrm)*coef;
+    p0   (k,icrm) = mean_sum(2,k,icrm)*coef;
+    t0   (k,icrm) = mean_sum(3,k,icrm)*coef;
+    tabs0(k,icrm) = mean_sum(4,k,icrm)*coef;
+    q0   (k,icrm) = mean_sum(5,k,icrm)*coef;
+    qn0  (k,icrm) = mean_sum(6,k,icrm)*coef;
+    qp0  (k,icrm) = mean_sum(7,k,icrm)*coef;
   });
+#endif
 
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -107,6 +139,18 @@ void diagnose() {
     qv0(k,icrm) = q0(k,icrm) - qn0(k,icrm);
   });
 
+  // The two-dimensional statistics below are not used by the GCM, so they are
+  // only accumulated on the calls that reduce the CRM statistics
+  if (!do_crm_stats) { return; }
+
+  //   for (int j=0; j<ny; j++) {
+  //     for (int i=0; i<nx; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(ny,nx,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    usfc_xy(j,i,icrm) = usfc_xy(j,i,icrm) + u(0,j+offy_s,i+offx_s,icrm)*dtfactor;
+    vsfc_xy(j,i,icrm) = vsfc_xy(j,i,icrm) + v(0,j+offy_s,i+offx_s,icrm)*dtfactor;
+  });
+
   //=====================================================
   // UW ADDITIONS
   // FIND VERTICAL INDICES OF 850MB, COMPUTE SWVP
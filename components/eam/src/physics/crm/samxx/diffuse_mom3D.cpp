@@ -26,6 +26,11 @@ void diffuse_mom3D(real5d &tk) {
   YAKL_SCOPE( adz           , :: adz );
   YAKL_SCOPE( ncrms         , :: ncrms );
 
+  if (use_fused_diffusion) {
+    diffuse_mom3D_fused(tk);
+    return;
+  }
+
   real4d fu("fu",nz,ny+1,nx+1,ncrms);
   real4d fv("fv",nz,ny+1,nx+1,ncrms);
   real4d fw("fw",nz,ny+1,nx+1,ncrms);
@@ -184,3 +189,169 @@ void diffuse_mom3D(real5d &tk) {
   });
 
 }
+
+
+// Fused form of diffuse_mom3D: every cell evaluates the fluxes through its faces
+// in registers with the same expressions as the split passes above and updates
+// its own dudt, dvdt and dwdt in a single pass. It agrees with the split passes
+// to rounding; FMA contraction can differ between the two
+void diffuse_mom3D_fused(real5d &tk) {
+  YAKL_SCOPE( dx            , :: dx );
+  YAKL_SCOPE( dy            , :: dy );
+  YAKL_SCOPE( dz            , :: dz );
+  YAKL_SCOPE( adzw          , :: adzw );
+  YAKL_SCOPE( grdf_x        , :: grdf_x );
+  YAKL_SCOPE( grdf_y        , :: grdf_y );
+  YAKL_SCOPE( grdf_z        , :: grdf_z );
+  YAKL_SCOPE( u             , :: u );
+  YAKL_SCOPE( v             , :: v );
+  YAKL_SCOPE( w             , :: w );
+  YAKL_SCOPE( na            , :: na );
+  YAKL_SCOPE( dudt          , :: dudt );
+  YAKL_SCOPE( dvdt          , :: dvdt );
+  YAKL_SCOPE( dwdt          , :: dwdt );
+  YAKL_SCOPE( uwsb          , :: uwsb );
+  YAKL_SCOPE( vwsb          , :: vwsb );
+  YAKL_SCOPE( rho           , :: rho );
+  YAKL_SCOPE( rhow          , :: rhow );
+  YAKL_SCOPE( fluxbu        , :: fluxbu );
+  YAKL_SCOPE( fluxbv        , :: fluxbv );
+  YAKL_SCOPE( fluxtu        , :: fluxtu );
+  YAKL_SCOPE( fluxtv        , :: fluxtv );
+  YAKL_SCOPE( adz           , :: adz );
+  YAKL_SCOPE( ncrms         , :: ncrms );
+
+  real rdx2=1.0/(dx*dx);
+  real rdy2=1.0/(dy*dy);
+  real rdx25=0.25*rdx2;
+  real rdy25=0.25*rdy2;
+  real dxy=dx/dy;
+  real dyx=dy/dx;
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    uwsb(k,icrm)=0.0;
+    vwsb(k,icrm)=0.0;
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny; j++) {
+  //     for (int i=0; i<nx; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    int kc=k+1;
+    int kcu=min(kc,nzm-1);
+    int ib=i-1;
+    int jb=j-1;
+
+    // x faces at i-1/2 and i+1/2
+    real fu_x[2], fv_x[2], fw_x[2];
+    real dxz=dx/(dz(icrm)*adzw(kc,icrm));
+    real rdx21=rdx2    * grdf_x(k,icrm);
+    real rdx251=rdx25  * grdf_x(k,icrm);
+    for (int s=0; s<2; s++) {
+      int il=i+s-1;
+      int ir=i+s;
+      real tkx=rdx21*tk(0,k,j+offy_d,il+offx_d,icrm);
+      fu_x[s]=-2.0*tkx*(u(k,j+offy_u,ir+offx_u,icrm)-u(k,j+offy_u,il+offx_u,icrm));
+      tkx=rdx251*(tk(0,k,j+offy_d,il+offx_d,icrm)+tk(0,k,jb+offy_d,il+offx_d,icrm)+
+                  tk(0,k,j+offy_d,ir+offx_d,icrm)+tk(0,k,jb+offy_d,ir+offx_d,icrm));
+      fv_x[s]=-tkx*(v(k,j+offy_v,ir+offx_v,icrm)-v(k,j+offy_v,il+offx_v,icrm)+
+                   (u(k,j+offy_u,ir+offx_u,icrm)-u(k,jb+offy_u,ir+offx_u,icrm))*dxy);
+      tkx=rdx251*(tk(0,k,j+offy_d,il+offx_d,icrm)+tk(0,k,j+offy_d,ir+offx_d,icrm)+
+                  tk(0,kcu,j+offy_d,il+offx_d,icrm)+tk(0,kcu,j+offy_d,ir+offx_d,icrm));
+      fw_x[s]=-tkx*(w(kc,j+offy_w,ir+offx_w,icrm)-w(kc,j+offy_w,il+offx_w,icrm)+
+                   (u(kcu,j+offy_u,ir+offx_u,icrm)-u(k,j+offy_u,ir+offx_u,icrm))*dxz);
+    }
+
+    // y faces at j-1/2 and j+1/2
+    real fu_y[2], fv_y[2], fw_y[2];
+    real dyz=dy/(dz(icrm)*adzw(kc,icrm));
+    real rdy21=rdy2    * grdf_y(k,icrm);
+    real rdy251=rdy25  * grdf_y(k,icrm);
+    for (int s=0; s<2; s++) {
+      int jl=j+s-1;
+      int jr=j+s;
+      real tky=rdy21*tk(0,k,jl+offy_d,i+offx_d,icrm);
+      fv_y[s]=-2.0*tky*(v(k,jr+offy_v,i+offx_v,icrm)-v(k,jl+offy_v,i+offx_v,icrm));
+      tky=rdy251*(tk(0,k,jl+offy_d,i+offx_d,icrm)+tk(0,k,jl+offy_d,ib+offx_d,icrm)+
+                  tk(0,k,jr+offy_d,i+offx_d,icrm)+tk(0,k,jr+offy_d,ib+offx_d,icrm));
+      fu_y[s]=-tky*(u(k,jr+offy_u,i+offx_u,icrm)-u(k,jl+offy_u,i+offx_u,icrm)+
+                   (v(k,jr+offy_v,i+offx_v,icrm)-v(k,jr+offy_v,ib+offx_v,icrm))*dyx);
+      tky=rdy251*(tk(0,k,jl+offy_d,i+offx_d,icrm)+tk(0,k,jr+offy_d,i+offx_d,icrm)+
+                  tk(0,kcu,jl+offy_d,i+offx_d,icrm)+tk(0,kcu,jr+offy_d,i+offx_d,icrm));
+      fw_y[s]=-tky*(w(kc,jr+offy_w,i+offx_w,icrm)-w(kc,jl+offy_w,i+offx_w,icrm)+
+                   (v(kcu,jr+offy_v,i+offx_v,icrm)-v(k,jr+offy_v,i+offx_v,icrm))*dyz);
+    }
+
+    // u and v fluxes through the z faces at k-1/2 and k+1/2
+    real fu_z[2], fv_z[2];
+    real rdz=1.0/dz(icrm);
+    for (int s=0; s<2; s++) {
+      int kf=k+s;
+      if (kf == 0) {
+        fu_z[s]=fluxbu(j,i,icrm) * rdz * rhow(0,icrm);
+        fv_z[s]=fluxbv(j,i,icrm) * rdz * rhow(0,icrm);
+      } else if (kf == nz-1) {
+        fu_z[s]=fluxtu(j,i,icrm) * rdz * rhow(nz-1,icrm);
+        fv_z[s]=fluxtv(j,i,icrm) * rdz * rhow(nz-1,icrm);
+      } else {
+        int kl=kf-1;
+        real rdz2 = rdz*rdz * grdf_z(kl,icrm);
+        real rdz25 = 0.25*rdz2;
+        real iadzw= 1.0/adzw(kf,icrm);
+        real dzx=dz(icrm)/dx;
+        real dzy=dz(icrm)/dy;
+        real tkz=rdz25*(tk(0,kl,j+offy_d,i+offx_d,icrm)+tk(0,kl,j+offy_d,ib+offx_d,icrm)+tk(0,kf,j+offy_d,i+offx_d,icrm)+
+                        tk(0,kf,j+offy_d,ib+offx_d,icrm));
+        fu_z[s]=-tkz*( (u(kf,j+offy_u,i+offx_u,icrm)-u(kl,j+offy_u,i+offx_u,icrm))*iadzw + 
+                       (w(kf,j+offy_w,i+offx_w,icrm)-w(kf,j+offy_w,ib+offx_w,icrm))*dzx)*rhow(kf,icrm);
+        tkz=rdz25*(tk(0,kl,j+offy_d,i+offx_d,icrm)+tk(0,kl,jb+offy_d,i+offx_d,icrm)+tk(0,kf,j+offy_d,i+offx_d,icrm)+
+                   tk(0,kf,jb+offy_d,i+offx_d,icrm));
+        fv_z[s]=-tkz*( (v(kf,j+offy_v,i+offx_v,icrm)-v(kl,j+offy_v,i+offx_v,icrm))*iadzw + 
+                       (w(kf,j+offy_w,i+offx_w,icrm)-w(kf,jb+offy_w,i+offx_w,icrm))*dzy)*rhow(kf,icrm);
+      }
+    }
+    if (k == 0) {
+      yakl::atomicAdd(uwsb(0,icrm),fu_z[0]);
+      yakl::atomicAdd(vwsb(0,icrm),fv_z[0]);
+    }
+    if (k <= nzm-2) {
+      yakl::atomicAdd(uwsb(kc,icrm),fu_z[1]);
+      yakl::atomicAdd(vwsb(kc,icrm),fv_z[1]);
+    }
+
+    real rhoi = 1.0/(rho(k,icrm)*adz(k,icrm));
+    dudt(na-1,k,j,i,icrm)=dudt(na-1,k,j,i,icrm)-(fu_x[1]-fu_x[0]);
+    dudt(na-1,k,j,i,icrm)=dudt(na-1,k,j,i,icrm)-(fu_y[1]-fu_y[0]);
+    dudt(na-1,k,j,i,icrm)=dudt(na-1,k,j,i,icrm)-(fu_z[1]-fu_z[0])*rhoi;
+    dvdt(na-1,k,j,i,icrm)=dvdt(na-1,k,j,i,icrm)-(fv_x[1]-fv_x[0]);
+    dvdt(na-1,k,j,i,icrm)=dvdt(na-1,k,j,i,icrm)-(fv_y[1]-fv_y[0]);
+    dvdt(na-1,k,j,i,icrm)=dvdt(na-1,k,j,i,icrm)-(fv_z[1]-fv_z[0])*rhoi;
+    dwdt(na-1,kc,j,i,icrm)=dwdt(na-1,kc,j,i,icrm)-(fw_x[1]-fw_x[0]);
+    dwdt(na-1,kc,j,i,icrm)=dwdt(na-1,kc,j,i,icrm)-(fw_y[1]-fw_y[0]);
+
+    // w flux through the z faces at the w levels kc and kc+1
+    if (k <= nzm-2) {
+      real fw_z[2];
+      for (int s=0; s<2; s++) {
+        int kl=k+s;
+        if (kl <= nzm-2) {
+          int kf=kl+1;
+          real rdz2 = rdz*rdz * grdf_z(kl,icrm);
+          real iadz = 1.0/adz(kl,icrm);
+          real tkz=rdz2*tk(0,kl,j+offy_d,i+offx_d,icrm);
+          fw_z[s]=-2.0*tkz*(w(kf,j+offy_w,i+offx_w,icrm)-w(kl,j+offy_w,i+offx_w,icrm))*rho(kl,icrm)*iadz;
+        } else {
+          real rdz2 = rdz*rdz * grdf_z(nzm-2,icrm);
+          real tkz=rdz2*grdf_z(nzm-1,icrm)*tk(0,nzm-1,j+offy_d,i+offx_d,icrm);
+          fw_z[s]=-2.0*tkz*(w(nz-1,j+offy_d,i+offx_d,icrm)-w(nzm-1,j+offy_w,i+offx_w,icrm))/
+                  adz(nzm-1,icrm)*rho(nzm-1,icrm);
+        }
+      }
+      real rhoiw = 1.0/(rhow(kc,icrm)*adzw(kc,icrm));
+      dwdt(na-1,kc,j,i,icrm)=dwdt(na-1,kc,j,i,icrm)-(fw_z[1]-fw_z[0])*rhoiw;
+    }
+  });
+}
@@ -5,4 +5,5 @@
 #include "vars.h"
 
 void diffuse_mom3D(real5d &tk);
+void diffuse_mom3D_fused(real5d &tk);
 
@@ -1,5 +1,104 @@
 #include "diffuse_scalar3D.h"
 
+// The overloads below differ only in how they index the field, the boundary
+// fluxes and the column flux. These views let one fused kernel serve all three.
+struct Field4d { real4d a;         YAKL_INLINE real &operator()(int k, int j, int i, int icrm) const { return a(    k,j,i,icrm); } };
+struct Field5d { real5d a; int ind; YAKL_INLINE real &operator()(int k, int j, int i, int icrm) const { return a(ind,k,j,i,icrm); } };
+struct Surf3d  { real3d a;         YAKL_INLINE real &operator()(int j, int i, int icrm) const { return a(    j,i,icrm); } };
+struct Surf4d  { real4d a; int ind; YAKL_INLINE real &operator()(int j, int i, int icrm) const { return a(ind,j,i,icrm); } };
+struct Col2d   { real2d a;         YAKL_INLINE real &operator()(int k, int icrm) const { return a(    k,icrm); } };
+struct Col3d   { real3d a; int ind; YAKL_INLINE real &operator()(int k, int icrm) const { return a(ind,k,icrm); } };
+
+// Fused path: every cell evaluates its six face fluxes in registers with the
+// same expressions as the split path, so the flux arrays and their separate
+// passes are not needed. The operations match the split path one for one, but
+// the compiler may contract them differently, so results agree to rounding
+// rather than bit for bit.
+template <class F, class S, class C>
+static void diffuse_scalar3D_fused(F field, S fluxb, S fluxt, real5d &tkh, int ind_tkh, C flux) {
+  YAKL_SCOPE( dx     , ::dx );
+  YAKL_SCOPE( dy     , ::dy );
+  YAKL_SCOPE( rhow   , ::rhow );
+  YAKL_SCOPE( adzw   , ::adzw );
+  YAKL_SCOPE( adz    , ::adz );
+  YAKL_SCOPE( dz     , ::dz ); 
+  YAKL_SCOPE( dtn    , ::dtn );
+  YAKL_SCOPE( rho    , ::rho );
+  YAKL_SCOPE( grdf_x , ::grdf_x );
+  YAKL_SCOPE( grdf_y , ::grdf_y );
+  YAKL_SCOPE( grdf_z , ::grdf_z );
+  YAKL_SCOPE( ncrms  , ::ncrms );
+
+  ArenaScope arena_scope;
+  real4d dfdt = arena_array<real4d>("dfdt", nzm, ny, nx, ncrms);
+
+  real rdx2=1.0/(dx*dx);
+  real rdy2=1.0/(dy*dy);
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    flux(k,icrm) = 0.0;
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny; j++) {
+  //     for (int i=0; i<nx; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    // x and y fluxes through the faces at i-1/2, i+1/2 and j-1/2, j+1/2
+    real flx_x[2], flx_y[2];
+    real rdx5=0.5*rdx2 * grdf_x(k,icrm);
+    real rdy5=0.5*rdy2 * grdf_y(k,icrm);
+    for (int s=0; s<2; s++) {
+      int ib=i+s-1;
+      int ic=i+s;
+      real tkx=rdx5*(tkh(ind_tkh,k,j+offy_d,ib+offx_d,icrm)+tkh(ind_tkh,k,j+offy_d,ic+offx_d,icrm));
+      flx_x[s]=-tkx*(field(k,j+offy_s,ic+offx_s,icrm)-field(k,j+offy_s,ib+offx_s,icrm));
+      int jb=j+s-1;
+      int jc=j+s;
+      real tky=rdy5*(tkh(ind_tkh,k,jb+offy_d,i+offx_d,icrm)+tkh(ind_tkh,k,jc+offy_d,i+offx_d,icrm));
+      flx_y[s]=-tky*(field(k,jc+offy_s,i+offx_s,icrm)-field(k,jb+offy_s,i+offx_s,icrm));
+    }
+
+    // z fluxes through the faces at k-1/2 and k+1/2
+    real flx_z[2];
+    real rdz=1.0/dz(icrm);
+    for (int s=0; s<2; s++) {
+      int kb=k+s-1;
+      int kc=k+s;
+      if (kc == 0) {
+        flx_z[s]=fluxb(j,i,icrm)*rdz*rhow(0,icrm);
+      } else if (kc == nzm) {
+        real tmp=1.0/adzw(nz-1,icrm);
+        flx_z[s]=fluxt(j,i,icrm)*rdz*tmp*rhow(nz-1,icrm);
+      } else {
+        real rhoi = rhow(kc,icrm)/adzw(kc,icrm);
+        real rdz2 = 1.0/(dz(icrm)*dz(icrm));
+        real rdz5 = 0.5*rdz2 * grdf_z(kb,icrm);
+        real tkz = rdz5*(tkh(ind_tkh,kb,j+offy_d,i+offx_d,icrm)+tkh(ind_tkh,kc,j+offy_d,i+offx_d,icrm));
+        flx_z[s]=-tkz*(field(kc,j+offy_s,i+offx_s,icrm)-field(kb,j+offy_s,i+offx_s,icrm))*rhoi;
+      }
+    }
+    if (k == 0    ) { yakl::atomicAdd(flux(0,icrm),flx_z[0]); }
+    if (k <= nzm-2) { yakl::atomicAdd(flux(k+1,icrm),flx_z[1]); }
+
+    real rhoi = 1.0/(adz(k,icrm)*rho(k,icrm));
+    real tend = 0.0;
+    tend=tend-(flx_x[1]-flx_x[0]);
+    tend=tend-(flx_y[1]-flx_y[0]);
+    dfdt(k,j,i,icrm)=dtn*(tend-(flx_z[1]-flx_z[0])*rhoi);
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny; j++) {
+  //     for (int i=0; i<nx; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    field(k,j+offy_s,i+offx_s,icrm)=field(k,j+offy_s,i+offx_s,icrm)+dfdt(k,j,i,icrm);
+  });
+}
+
 void diffuse_scalar3D(real4d &field, real3d &fluxb, real3d &fluxt, real5d &tkh,
                       int ind_tkh, real2d &flux) {
   YAKL_SCOPE( dx     , ::dx );
@@ -15,11 +114,17 @@ void diffuse_scalar3D(real4d &field, real3d &fluxb, real3d &fluxt, real5d &tkh,
   YAKL_SCOPE( grdf_z , ::grdf_z );
   YAKL_SCOPE( ncrms  , ::ncrms );
 
+  if (dosgs && use_fused_diffusion) {
+    diffuse_scalar3D_fused(Field4d{field}, Surf3d{fluxb}, Surf3d{fluxt}, tkh, ind_tkh, Col2d{flux});
+    return;
+  }
+
   if (dosgs) {
-    real4d flx_x("flx_x", nzm+1, ny+1, nx+1, ncrms);
-    real4d flx_y("flx_y", nzm+1, ny+1, nx+1, ncrms);
-    real4d flx_z("flx_z", nzm+1, ny+1, nx+1, ncrms);
-    real4d dfdt("dfdt", nz, ny, nx, ncrms);
+    ArenaScope arena_scope;
+    real4d flx_x = arena_array<real4d>("flx_x", nzm+1, ny+1, nx+1, ncrms);
+    real4d flx_y = arena_array<real4d>("flx_y", nzm+1, ny+1, nx+1, ncrms);
+    real4d flx_z = arena_array<real4d>("flx_z", nzm+1, ny+1, nx+1, ncrms);
+    real4d dfdt = arena_array<real4d>("dfdt", nz, ny, nx, ncrms);
 
     int constexpr offx_flx = 1;
     int constexpr offy_flx = 1;
@@ -132,11 +237,17 @@ void diffuse_scalar3D(real5d &field, int ind_field, real3d &fluxb, real3d &fluxt
   YAKL_SCOPE( grdf_z , ::grdf_z );
   YAKL_SCOPE( ncrms  , ::ncrms );
   
+  if (dosgs && use_fused_diffusion) {
+    diffuse_scalar3D_fused(Field5d{field,ind_field}, Surf3d{fluxb}, Surf3d{fluxt}, tkh, ind_tkh, Col2d{flux});
+    return;
+  }
+
   if (dosgs) {
-    real4d flx_x("flx_x", nzm+1, ny+1, nx+1, ncrms);
-    real4d flx_y("flx_y", nzm+1, ny+1, nx+1, ncrms);
-    real4d flx_z("flx_z", nzm+1, ny+1, nx+1, ncrms);
-    real4d dfdt("dfdt", nz, ny, nx, ncrms);
+    ArenaScope arena_scope;
+    real4d flx_x = arena_array<real4d>("flx_x", nzm+1, ny+1, nx+1, ncrms);
+    real4d flx_y = arena_array<real4d>("flx_y", nzm+1, ny+1, nx+1, ncrms);
+    real4d flx_z = arena_array<real4d>("flx_z", nzm+1, ny+1, nx+1, ncrms);
+    real4d dfdt = arena_array<real4d>("dfdt", nz, ny, nx, ncrms);
     int constexpr offx_flx = 1;
     int constexpr offy_flx = 1;
     int constexpr offz_flx = 1;
@@ -249,11 +360,18 @@ void diffuse_scalar3D(real5d &field, int ind_field, real4d &fluxb, int ind_fluxb
   YAKL_SCOPE( grdf_z , ::grdf_z );
   YAKL_SCOPE( ncrms  , ::ncrms );
   
+  if (dosgs && use_fused_diffusion) {
+    diffuse_scalar3D_fused(Field5d{field,ind_field}, Surf4d{fluxb,ind_fluxb}, Surf4d{fluxt,ind_fluxt}, tkh, ind_tkh,
+                           Col3d{flux,ind_flux});
+    return;
+  }
+
   if (dosgs) {
-    real4d flx_x("flx_x", nzm+1, ny+1, nx+1, ncrms);
-    real4d flx_y("flx_y", nzm+1, ny+1, nx+1, ncrms);
-    real4d flx_z("flx_z", nzm+1, ny+1, nx+1, ncrms);
-    real4d dfdt("dfdt", nz, ny, nx, ncrms);
+    ArenaScope arena_scope;
+    real4d flx_x = arena_array<real4d>("flx_x", nzm+1, ny+1, nx+1, ncrms);
+    real4d flx_y = arena_array<real4d>("flx_y", nzm+1, ny+1, nx+1, ncrms);
+    real4d flx_z = arena_array<real4d>("flx_z", nzm+1, ny+1, nx+1, ncrms);
+    real4d dfdt = arena_array<real4d>("dfdt", nz, ny, nx, ncrms);
 
     int constexpr offx_flx = 1;
     int constexpr offy_flx = 1;
@@ -53,7 +53,7 @@ void forcing() {
     if(nneg(k,icrm) > 0 && qpoz(k,icrm)+qneg(k,icrm) > 0.0) {
       factor =  1.0 + qneg(k,icrm)/qpoz(k,icrm);
       micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) = 
-            max(0.0,micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm)*factor);
+            max((real) 0.0,micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm)*factor);
     }
   });
 }
@@ -1,6 +1,13 @@
 
 #include "kurant.h"
 #include "vars.h"
+#include <vector>
+
+namespace {
+  // ncycle_crm and ncycle_crm_max of the last crm() call, for crm_get_ncycle
+  std::vector<int> ncycle_crm_last;
+  std::vector<int> ncycle_crm_max_last;
+}
 
 void kurant () {
   YAKL_SCOPE( w     , ::w );
@@ -12,18 +19,22 @@ void kurant () {
   YAKL_SCOPE( dz    , ::dz );
   YAKL_SCOPE( adzw  , ::adzw );
   YAKL_SCOPE( ncrms , ::ncrms );
+  YAKL_SCOPE( ncycle_crm  , ::ncycle_crm );
+  YAKL_SCOPE( ncycle_crm_max , ::ncycle_crm_max );
+  YAKL_SCOPE( ncycle_hist , ::ncycle_hist );
 
-  int constexpr max_ncycle = 4;
   real cfl;
 
   real2d wm    ("wm"   ,nz ,ncrms);
   real2d uhm   ("uhm"  ,nz ,ncrms);
   real2d tmpMax("uhMax",nzm,ncrms);
+  real1d cfl_crm("cfl_crm",ncrms);
 
   ncycle = 1;
   parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
     wm(k,icrm) = 0.0;
     uhm(k,icrm) = 0.0;
+    if (k == 0) { cfl_crm(icrm) = 0.0; }
   });
 
   // for (int k=0; k<nzm; k++) {
@@ -51,6 +62,7 @@ void kurant () {
     real tmp2 = wm(k,icrm)*dt/dztemp;
     real tmp3 = wm(k+1,icrm)*dt/dztemp;
     tmpMax(k,icrm) = max(max(tmp1,tmp2),tmp3);
+    yakl::atomicMax(cfl_crm(icrm),tmpMax(k,icrm));
   });
 
   yakl::ParallelMax<real,yakl::memDevice> pmax( nzm*ncrms );
@@ -64,10 +76,23 @@ void kurant () {
     exit(-1);
   }
 
-  kurant_sgs(cfl);
+  kurant_sgs(cfl, cfl_crm);
 
   ncycle = max(ncycle,max(1,static_cast<int>(ceil(cfl/0.7))));
 
+  // The CRMs of this call share one time step, so every one runs ncycle
+  // substeps. Record how many each needs on its own, summed over the crm()
+  // call as a per-column cost and at most on one step for the GCM to batch
+  // CRMs of similar need, and with MMF_NCYCLE_STATS their distribution.
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+    int n = max(1,static_cast<int>(ceil(cfl_crm(icrm)/0.7)));
+    ncycle_crm(icrm) += n;
+    ncycle_crm_max(icrm) = max(ncycle_crm_max(icrm),n);
+#ifdef MMF_NCYCLE_STATS
+    yakl::atomicAdd(ncycle_hist(min(n,max_ncycle)),1);
+#endif
+  });
+
 #ifdef MMF_FIXED_SUBCYCLE
   ncycle = max_ncycle;
 #endif
@@ -76,6 +101,43 @@ void kurant () {
     std::cout << "\nkurant() - the number of cycles exceeded max_ncycle = "<< max_ncycle << std::endl;
     exit(-1);
   }
+
+#ifdef MMF_NCYCLE_STATS
+  ncycle_batch_steps += static_cast<long>(ncycle)*ncrms;
+#endif
 }
 
 
+void kurant_report() {
+#ifdef MMF_NCYCLE_STATS
+  if (!gcm_masterproc) { return; }
+  auto hist = ncycle_hist.createHostCopy();
+  long needed = 0;
+  long ncrm_steps = 0;
+  for (int n=1; n<=max_ncycle; n++) {
+    needed     += static_cast<long>(n)*hist(n);
+    ncrm_steps += hist(n);
+  }
+  if (ncrm_steps == 0) { return; }
+  std::cout << "samxx kurant: CRM steps needing 1.." << max_ncycle << " substeps:";
+  for (int n=1; n<=max_ncycle; n++) { std::cout << " " << hist(n); }
+  std::cout << "; substeps run " << ncycle_batch_steps << ", needed per CRM " << needed << std::endl;
+#endif
+}
+
+
+void kurant_save() {
+  auto ncycle_host = ncycle_crm.createHostCopy();
+  auto ncycle_max_host = ncycle_crm_max.createHostCopy();
+  ncycle_crm_last.assign(ncycle_host.data(), ncycle_host.data() + ncrms);
+  ncycle_crm_max_last.assign(ncycle_max_host.data(), ncycle_max_host.data() + ncrms);
+}
+
+
+extern "C" void crm_get_ncycle(int *ncycle_out, int *ncycle_max_out, int ncrms_in) {
+  for (int icrm=0; icrm<ncrms_in; icrm++) {
+    bool known = icrm < (int) ncycle_crm_last.size();
+    ncycle_out    [icrm] = known ? ncycle_crm_last    [icrm] : 1;
+    ncycle_max_out[icrm] = known ? ncycle_crm_max_last[icrm] : 1;
+  }
+}
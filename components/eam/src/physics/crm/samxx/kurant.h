@@ -7,3 +7,16 @@
 
 void kurant();
 
+// Keep ncycle_crm and ncycle_crm_max past the end of the crm() call for
+// crm_get_ncycle.
+void kurant_save();
+
+// Copy the substeps each CRM needed over the last crm() call, a per-column
+// cost for the GCM's load balancing, and at most on one step, which the GCM
+// uses to batch CRMs of similar need.
+extern "C" void crm_get_ncycle(int *ncycle_out, int *ncycle_max_out, int ncrms_in);
+
+// Print the per-CRM substep distribution of this crm() call on the GCM master
+// task (MMF_NCYCLE_STATS), next to the substeps the call ran.
+void kurant_report();
+
@@ -28,16 +28,17 @@ void precip_fall(int hydro_type, real4d &omega) {
   real constexpr eps = 1.e-10;
   bool constexpr nonos = true;
 
-  real4d mx("mx",nzm,ny,nx,ncrms);
-  real4d mn("mn",nzm,ny,nx,ncrms);
-  real4d lfac("lfac",nz,ny,nx,ncrms);
-  real4d www("www",nz,ny,nx,ncrms);
-  real4d fz("fz",nz,ny,nx,ncrms);
-  real4d wp("wp",nzm,ny,nx,ncrms);
-  real4d tmp_qp("tmp_qp",nzm,ny,nx,ncrms);
-  real2d irhoadz("irhoadz",nzm,ncrms);
-  real2d iwmax("iwmax",nzm,ncrms);
-  real2d rhofac("rhofac",nzm,ncrms);
+  ArenaScope arena_scope;
+  real4d mx = arena_array<real4d>("mx",nzm,ny,nx,ncrms);
+  real4d mn = arena_array<real4d>("mn",nzm,ny,nx,ncrms);
+  real4d lfac = arena_array<real4d>("lfac",nz,ny,nx,ncrms);
+  real4d www = arena_array<real4d>("www",nz,ny,nx,ncrms);
+  real4d fz = arena_array<real4d>("fz",nz,ny,nx,ncrms);
+  real4d wp = arena_array<real4d>("wp",nzm,ny,nx,ncrms);
+  real4d tmp_qp = arena_array<real4d>("tmp_qp",nzm,ny,nx,ncrms);
+  real2d irhoadz = arena_array<real2d>("irhoadz",nzm,ncrms);
+  real2d iwmax = arena_array<real2d>("iwmax",nzm,ncrms);
+  real2d rhofac = arena_array<real2d>("rhofac",nzm,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -51,7 +52,7 @@ void precip_fall(int hydro_type, real4d &omega) {
 
   //  Add sedimentation of precipitation field to the vert. vel.
   real prec_cfl = 0.0;
-  real4d prec_cfl_arr("prec_cfl_arr",nzm,ny,nx,ncrms);
+  real4d prec_cfl_arr = arena_array<real4d>("prec_cfl_arr",nzm,ny,nx,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny; j++) {
@@ -188,8 +189,8 @@ void precip_fall(int hydro_type, real4d &omega) {
       parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
         int kb=max(0,k-1);
         // Add limited flux correction to fz(k).
-        fz(k,j,i,icrm) = fz(k,j,i,icrm) + pp(www(k,j,i,icrm))*min(1.0,min(mx(k,j,i,icrm), mn(kb,j,i,icrm))) -
-                                        pn(www(k,j,i,icrm))*min(1.0,min(mx(kb,j,i,icrm),mn(k,j,i,icrm))); // Anti-diffusive flux
+        fz(k,j,i,icrm) = fz(k,j,i,icrm) + pp(www(k,j,i,icrm))*min((real) 1.0,min(mx(k,j,i,icrm), mn(kb,j,i,icrm))) -
+                                        pn(www(k,j,i,icrm))*min((real) 1.0,min(mx(kb,j,i,icrm),mn(k,j,i,icrm))); // Anti-diffusive flux
       });
     }
 
@@ -255,7 +256,8 @@ void micro_precip_fall() {
   YAKL_SCOPE( a_pr  , ::a_pr );
   YAKL_SCOPE( ncrms , ::ncrms );
 
-  real4d omega("omega", nzm, ny, nx, ncrms);
+  ArenaScope arena_scope;
+  real4d omega = arena_array<real4d>("omega", nzm, ny, nx, ncrms);
 
   crain = b_rain / 4.0;
   csnow = b_snow / 4.0;
@@ -269,7 +271,7 @@ void micro_precip_fall() {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    omega(k,j,i,icrm) = max(0.0,min(1.0,(tabs(k,j,i,icrm)-tprmin)*a_pr));
+    omega(k,j,i,icrm) = max((real) 0.0,min((real) 1.0,(tabs(k,j,i,icrm)-tprmin)*a_pr));
   });
 
   precip_fall(2,omega);
@@ -311,10 +313,10 @@ void micro_diagnose() {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     qv(k,j,i,icrm) = micro_field(0,k,j+offy_s,i+offx_s,icrm) - qn(k,j,i,icrm);
-    real omn = max(0.0,min(1.0,(tabs(k,j,i,icrm)-tbgmin)*a_bg));
+    real omn = max((real) 0.0,min((real) 1.0,(tabs(k,j,i,icrm)-tbgmin)*a_bg));
     qcl(k,j,i,icrm) = qn(k,j,i,icrm)*omn;
     qci(k,j,i,icrm) = qn(k,j,i,icrm)*(1.0-omn);
-    real omp = max(0.0,min(1.0,(tabs(k,j,i,icrm)-tprmin)*a_pr));
+    real omp = max((real) 0.0,min((real) 1.0,(tabs(k,j,i,icrm)-tprmin)*a_pr));
     qpl(k,j,i,icrm) = micro_field(1,k,j+offy_s,i+offx_s,icrm)*omp;
     qpi(k,j,i,icrm) = micro_field(1,k,j+offy_s,i+offx_s,icrm)*(1.0-omp);
   });
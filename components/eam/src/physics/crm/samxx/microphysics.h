@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "vars.h"
+#include "arena.h"
 #include "cloud.h"
 #include "precip_init.h"
 #include "precip_proc.h"
@@ -12,18 +13,18 @@ YAKL_INLINE real term_vel_qp(int icrm, int i, int j, int k, real qploc, real vra
                              real tabs, real a_pr, real a_gr) {
   real term_vel = 0.0;
   if(qploc > qp_threshold) {
-    real omp = max(0.0,min(1.0,(tabs-tprmin)*a_pr));
+    real omp = max((real) 0.0,min((real) 1.0,(tabs-tprmin)*a_pr));
     if(omp == 1.0) {
       term_vel = vrain*pow(rho*qploc,crain);
     }
     else if(omp == 0.0) {
-      real omg = max(0.0,min(1.0,(tabs-tgrmin)*a_gr));
+      real omg = max((real) 0.0,min((real) 1.0,(tabs-tgrmin)*a_gr));
       real qgg=omg*qploc;
       real qss=qploc-qgg;
       term_vel = (omg*vgrau*pow(rho*qgg,cgrau) + (1.0-omg)*vsnow*pow(rho*qss,csnow));
     }
     else {
-      real omg = max(0.0,min(1.0,(tabs-tgrmin)*a_gr));
+      real omg = max((real) 0.0,min((real) 1.0,(tabs-tgrmin)*a_gr));
       real qrr=omp*qploc;
       real qss=qploc-qrr;
       real qgg=omg*qss;
@@ -48,11 +49,11 @@ void micro_proc();
 void micro_init();
 
 YAKL_INLINE real pp(real y) {
-  return max(0.0,y);
+  return max((real) 0.0,y);
 }
 
 YAKL_INLINE real pn(real y) {
-  return -min(0.0,y);
+  return -min((real) 0.0,y);
 }
 
 
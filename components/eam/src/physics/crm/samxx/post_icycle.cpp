@@ -45,7 +45,12 @@ void post_icycle() {
   YAKL_SCOPE( qpi                 , :: qpi );
   YAKL_SCOPE( qpl                 , :: qpl );
   YAKL_SCOPE( ncrms               , :: ncrms );
+  YAKL_SCOPE( do_crm_stats        , :: do_crm_stats );
 
+  // The cloud fraction, the cloud cover, the radiation columns and the clear
+  // sky RH are accumulated on every call; CLDTOT/CLDHGH/CLDMED/CLDLOW replace
+  // the GCM's own cloud cover on every step. Cloud top, mass flux and water
+  // path statistics are only accumulated when do_crm_stats is set.
   // for (int j=0; j<ny; j++) {
   //  for (int i=0; i<nx; i++) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
@@ -70,8 +75,8 @@ void post_icycle() {
       real tmp1 = rho(nz-(k+1)-1,icrm)*adz(nz-(k+1)-1,icrm)*dz(icrm)*(qcl(nz-(k+1)-1,j,i,icrm)+qci(nz-(k+1)-1,j,i,icrm));
       cwp   (j,i,icrm) = cwp(j,i,icrm)+tmp1;
       cttemp(j,i,icrm) = max(CF3D(nz-(k+1)-1,j,i,icrm), cttemp(j,i,icrm));
-      if (cwp(j,i,icrm) > cwp_threshold && flag_top(j,i,icrm) == 1) {
-        yakl::atomicAdd(crm_output_cldtop(l,icrm), 1.0);
+      if (do_crm_stats && cwp(j,i,icrm) > cwp_threshold && flag_top(j,i,icrm) == 1) {
+        yakl::atomicAdd(crm_output_cldtop(l,icrm), (real) 1.0);
         flag_top(j,i,icrm) = 0;
       }
       if (pres(nz-(k+1)-1,icrm) >= 700.0) {
@@ -85,6 +90,12 @@ void post_icycle() {
         cmtemp(j,i,icrm) = max(CF3D(nz-(k+1)-1,j,i,icrm), cmtemp(j,i,icrm));
       }
       tmp1 = rho(k,icrm)*adz(k,icrm)*dz(icrm);
+      if (!do_crm_stats) {
+        if(tmp1*(qcl(k,j,i,icrm)+qci(k,j,i,icrm)) > cwp_threshold) {
+          yakl::atomicAdd(crm_output_cld(l,icrm), CF3D(k,j,i,icrm));
+        }
+        continue;
+      }
       real tmp;
       if(tmp1*(qcl(k,j,i,icrm)+qci(k,j,i,icrm)) > cwp_threshold) {
          yakl::atomicAdd(crm_output_cld(l,icrm), CF3D(k,j,i,icrm));
@@ -128,7 +139,7 @@ void post_icycle() {
     real rh_tmp;
 
     yakl::atomicAdd(crm_rad_temperature(k,j_rad,i_rad,icrm) , tabs(k,j,i,icrm));
-    real tmp = max(0.0,qv(k,j,i,icrm));
+    real tmp = max((real) 0.0,qv(k,j,i,icrm));
     yakl::atomicAdd(crm_rad_qv(k,j_rad,i_rad,icrm) , tmp);
     yakl::atomicAdd(crm_rad_qc(k,j_rad,i_rad,icrm) , qcl(k,j,i,icrm));
     yakl::atomicAdd(crm_rad_qi(k,j_rad,i_rad,icrm) , qci(k,j,i,icrm));
@@ -142,6 +153,26 @@ void post_icycle() {
     }
   });
 
+  // for (int j=0; j<ny; j++) {
+  //  for (int i=0; i<nx; i++) {
+  //    for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(ny,nx,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    if(cwp(j,i,icrm) > cwp_threshold) {
+      yakl::atomicAdd(crm_output_cltot(icrm) , cttemp(j,i,icrm));
+    }
+    if(cwph(j,i,icrm) > cwp_threshold) {
+      yakl::atomicAdd(crm_output_clhgh(icrm) , chtemp(j,i,icrm));
+    }
+    if(cwpm(j,i,icrm) > cwp_threshold) {
+      yakl::atomicAdd(crm_output_clmed(icrm) , cmtemp(j,i,icrm));
+    }
+    if(cwpl(j,i,icrm) > cwp_threshold) {
+      yakl::atomicAdd(crm_output_cllow(icrm) , cltemp(j,i,icrm));
+    }
+  });
+
+  if (!do_crm_stats) { return; }
+
   // Diagnose mass fluxes to drive CAM's convective transport of tracers.
   // definition of mass fluxes is taken from Xu et al., 2002, QJRMS.
 
@@ -174,24 +205,6 @@ void post_icycle() {
     }
   });
 
-  // for (int j=0; j<ny; j++) {
-  //  for (int i=0; i<nx; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(ny,nx,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
-    if(cwp(j,i,icrm) > cwp_threshold) {
-      yakl::atomicAdd(crm_output_cltot(icrm) , cttemp(j,i,icrm));
-    }
-    if(cwph(j,i,icrm) > cwp_threshold) {
-      yakl::atomicAdd(crm_output_clhgh(icrm) , chtemp(j,i,icrm));
-    }
-    if(cwpm(j,i,icrm) > cwp_threshold) {
-      yakl::atomicAdd(crm_output_clmed(icrm) , cmtemp(j,i,icrm));
-    }
-    if(cwpl(j,i,icrm) > cwp_threshold) {
-      yakl::atomicAdd(crm_output_cllow(icrm) , cltemp(j,i,icrm));
-    }
-  });
-
 }
 
 
@@ -168,6 +168,7 @@ void post_timeloop() {
   YAKL_SCOPE( u_vt_tend               , :: u_vt_tend );
   YAKL_SCOPE( use_VT                  , :: use_VT );
   YAKL_SCOPE( use_ESMT                , :: use_ESMT );
+  YAKL_SCOPE( do_crm_stats            , :: do_crm_stats );
 
   factor_xyt = factor_xy/((real) nstop);
   real tmp1 = crm_nx_rad_fac*crm_ny_rad_fac/((real) nstop);
@@ -242,6 +243,7 @@ void post_timeloop() {
     });
   }
 
+#ifndef CRM_SINGLE_PRECISION
   // for (int k=0; k<nzm; k++) {
   //  for (int i=0; i<nx; i++) {
   //    for (int j=0; j<ny; j++) {
@@ -265,6 +267,50 @@ void post_timeloop() {
       yakl::atomicAdd(vln_esmt(l,icrm), v_esmt(k,j+offy_u,i+offx_u,icrm));
     }
   });
+#else
+  double3d ln_sum("ln_sum",8,nzm,ncrms);
+  yakl::memset(ln_sum,0.);
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int i=0; i<nx; i++) {
+  //    for (int j=0; j<ny; j++) {
+  //      for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    int l = plev-(k+1);
+
+    real tmp = (qpl(k,j,i,icrm)+qpi(k,j,i,icrm))*crm_input_pdel(l,icrm);
+    yakl::atomicAdd(colprec (icrm) , (double) tmp);
+
+    tmp = qpi(k,j,i,icrm)*crm_input_pdel(l,icrm);
+    yakl::atomicAdd(colprecs(icrm) , (double) tmp);
+    yakl::atomicAdd(ln_sum(0,k,icrm) , (double) tabs(k,j,i,icrm));
+    yakl::atomicAdd(ln_sum(1,k,icrm) , (double) qv(k,j,i,icrm));
+    yakl::atomicAdd(ln_sum(2,k,icrm) , (double) qcl(k,j,i,icrm));
+    yakl::atomicAdd(ln_sum(3,k,icrm) , (double) qci(k,j,i,icrm));
+    yakl::atomicAdd(ln_sum(4,k,icrm) , (double) u(k,j+offy_u,i+offx_u,icrm));
+    yakl::atomicAdd(ln_sum(5,k,icrm) , (double) v(k,j+offy_v,i+offx_v,icrm));
+    if (use_ESMT) {
+      yakl::atomicAdd(ln_sum(6,k,icrm), (double) u_esmt(k,j+offy_u,i+offx_u,icrm));
+      yakl::atomicAdd(ln_sum(7,k,icrm), (double) v_esmt(k,j+offy_u,i+offx_u,icrm));
+    }
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    int l = plev-(k+1);
+    tln  (l,icrm) = ln_sum(0,k,icrm);
+    qln  (l,icrm) = ln_sum(1,k,icrm);
+    qccln(l,icrm) = ln_sum(2,k,icrm);
+    qiiln(l,icrm) = ln_sum(3,k,icrm);
+    uln  (l,icrm) = ln_sum(4,k,icrm);
+    vln  (l,icrm) = ln_sum(5,k,icrm);
+    if (use_ESMT) {
+      uln_esmt(l,icrm) = ln_sum(6,k,icrm);
+      vln_esmt(l,icrm) = ln_sum(7,k,icrm);
+    }
+  });
+#endif
 
   // for (int k=0; k<plev-ptop+1; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -377,29 +423,68 @@ void post_timeloop() {
     crm_output_tauy(icrm) = tauy0(icrm) / nstop;
   });
 
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny; j++) {
-  //     for (int i=0; i<nx; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int l = plev-(k+1);
-    yakl::atomicAdd(crm_output_qc_mean(l,icrm) , qcl(k,j,i,icrm));
-    yakl::atomicAdd(crm_output_qi_mean(l,icrm) , qci(k,j,i,icrm));
-    yakl::atomicAdd(crm_output_qr_mean(l,icrm) , qpl(k,j,i,icrm));
-    real omg = max(0.0,min(1.0,(tabs(k,j,i,icrm)-tgrmin)*a_gr));
-
-    real tmp = qpi(k,j,i,icrm)*omg;
-    yakl::atomicAdd(crm_output_qg_mean(l,icrm) , tmp);
+  // The statistics below are only used for history output, so they are only
+  // reduced when do_crm_stats is set. The GCM uses the cloud fraction, the
+  // precipitation rates and the large-scale tendencies on every call.
+  if (do_crm_stats) {
+#ifndef CRM_SINGLE_PRECISION
+    // for (int k=0; k<nzm; k++) {
+    //   for (int j=0; j<ny; j++) {
+    //     for (int i=0; i<nx; i++) {
+    //       for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      int l = plev-(k+1);
+      yakl::atomicAdd(crm_output_qc_mean(l,icrm) , qcl(k,j,i,icrm));
+      yakl::atomicAdd(crm_output_qi_mean(l,icrm) , qci(k,j,i,icrm));
+      yakl::atomicAdd(crm_output_qr_mean(l,icrm) , qpl(k,j,i,icrm));
+      real omg = max(0.0,min(1.0,(tabs(k,j,i,icrm)-tgrmin)*a_gr));
+
+      real tmp = qpi(k,j,i,icrm)*omg;
+      yakl::atomicAdd(crm_output_qg_mean(l,icrm) , tmp);
+
+      tmp = qpi(k,j,i,icrm)*(1.0-omg);
+      yakl::atomicAdd(crm_output_qs_mean(l,icrm) , tmp);
+    });
+#else
+    double3d q_sum("q_sum",5,nzm,ncrms);
+    yakl::memset(q_sum,0.);
+
+    // for (int k=0; k<nzm; k++) {
+    //   for (int j=0; j<ny; j++) {
+    //     for (int i=0; i<nx; i++) {
+    //       for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      yakl::atomicAdd(q_sum(0,k,icrm) , (double) qcl(k,j,i,icrm));
+      yakl::atomicAdd(q_sum(1,k,icrm) , (double) qci(k,j,i,icrm));
+      yakl::atomicAdd(q_sum(2,k,icrm) , (double) qpl(k,j,i,icrm));
+      real omg = max((real) 0.0,min((real) 1.0,(tabs(k,j,i,icrm)-tgrmin)*a_gr));
+
+      real tmp = qpi(k,j,i,icrm)*omg;
+      yakl::atomicAdd(q_sum(3,k,icrm) , (double) tmp);
+
+      tmp = qpi(k,j,i,icrm)*(1.0-omg);
+      yakl::atomicAdd(q_sum(4,k,icrm) , (double) tmp);
+    });
 
-    tmp = qpi(k,j,i,icrm)*(1.0-omg);
-    yakl::atomicAdd(crm_output_qs_mean(l,icrm) , tmp);
-  });
+    // for (int k=0; k<nzm; k++) {
+    //  for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+      int l = plev-(k+1);
+      crm_output_qc_mean(l,icrm) = crm_output_qc_mean(l,icrm) + q_sum(0,k,icrm);
+      crm_output_qi_mean(l,icrm) = crm_output_qi_mean(l,icrm) + q_sum(1,k,icrm);
+      crm_output_qr_mean(l,icrm) = crm_output_qr_mean(l,icrm) + q_sum(2,k,icrm);
+      crm_output_qg_mean(l,icrm) = crm_output_qg_mean(l,icrm) + q_sum(3,k,icrm);
+      crm_output_qs_mean(l,icrm) = crm_output_qs_mean(l,icrm) + q_sum(4,k,icrm);
+    });
+#endif
+  }
 
   // for (int k=0; k<plev; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<2>(plev,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    crm_output_cld   (k,icrm) = min( 1.0, crm_output_cld   (k,icrm) * factor_xyt );
-    crm_output_cldtop(k,icrm) = min( 1.0, crm_output_cldtop(k,icrm) * factor_xyt );
+    crm_output_cld   (k,icrm) = min( (real) 1.0, crm_output_cld   (k,icrm) * factor_xyt );
+    if (!do_crm_stats) { return; }
+    crm_output_cldtop(k,icrm) = min( (real) 1.0, crm_output_cldtop(k,icrm) * factor_xyt );
     crm_output_gicewp(k,icrm) = crm_output_gicewp(k,icrm)*crm_input_pdel(k,icrm)*1000.0/ggr * factor_xyt;
     crm_output_gliqwp(k,icrm) = crm_output_gliqwp(k,icrm)*crm_input_pdel(k,icrm)*1000.0/ggr * factor_xyt;
     crm_output_mcup  (k,icrm) = crm_output_mcup (k,icrm) * factor_xyt;
@@ -416,6 +501,7 @@ void post_timeloop() {
     crm_output_qr_mean(k,icrm) = crm_output_qr_mean(k,icrm) * factor_xy;
   });
 
+#ifndef CRM_SINGLE_PRECISION
   // for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
     crm_output_precc (icrm) = 0.0;
@@ -438,13 +524,42 @@ void post_timeloop() {
       yakl::atomicAdd(crm_output_precsl(icrm) , precssfc(j,i,icrm));
     }
   });
+#else
+  double2d prec_sum("prec_sum",4,ncrms);
+  yakl::memset(prec_sum,0.);
 
   // for (int j=0; j<ny; j++) {
   //  for (int i=0; i<nx; i++) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(ny,nx,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
-    crm_output_prec_crm(j,i,icrm) = precsfc(j,i,icrm)/1000.0;           //mm/s --> m/s
+    precsfc(j,i,icrm) = precsfc(j,i,icrm)*dz(icrm)/dt/((real) nstop);
+    precssfc(j,i,icrm) = precssfc(j,i,icrm)*dz(icrm)/dt/((real) nstop);
+    if (precsfc(j,i,icrm) > 10.0/86400.0) {
+      yakl::atomicAdd(prec_sum(0,icrm) , (double) precsfc (j,i,icrm));
+      yakl::atomicAdd(prec_sum(2,icrm) , (double) precssfc(j,i,icrm));
+    } else {
+      yakl::atomicAdd(prec_sum(1,icrm) , (double) precsfc (j,i,icrm));
+      yakl::atomicAdd(prec_sum(3,icrm) , (double) precssfc(j,i,icrm));
+    }
+  });
+
+  // for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+    crm_output_precc (icrm) = prec_sum(0,icrm);
+    crm_output_precl (icrm) = prec_sum(1,icrm);
+    crm_output_precsc(icrm) = prec_sum(2,icrm);
+    crm_output_precsl(icrm) = prec_sum(3,icrm);
   });
+#endif
+
+  if (do_crm_stats) {
+    // for (int j=0; j<ny; j++) {
+    //  for (int i=0; i<nx; i++) {
+    //    for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<3>(ny,nx,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+      crm_output_prec_crm(j,i,icrm) = precsfc(j,i,icrm)/1000.0;           //mm/s --> m/s
+    });
+  }
 
   // for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
@@ -458,10 +573,32 @@ void post_timeloop() {
     crm_output_clmed(icrm) = crm_output_clmed(icrm) * factor_xyt;
     crm_output_cllow(icrm) = crm_output_cllow(icrm) * factor_xyt;
 
+    if (!do_crm_stats) { return; }
     crm_output_jt_crm(icrm) = plev * 1.0;
     crm_output_mx_crm(icrm) = 1.0;
   });
 
+  // for (int k=0; k<nzm; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    int l = plev-(k+1);
+    crm_output_qt_ls     (l,icrm) = qtend(k,icrm);
+    crm_output_t_ls      (l,icrm) = ttend(k,icrm);
+    if (use_VT) {
+      crm_output_t_vt_ls   (l,icrm) = t_vt_tend(k,icrm);
+      crm_output_q_vt_ls   (l,icrm) = q_vt_tend(k,icrm);
+      crm_output_u_vt_ls   (l,icrm) = u_vt_tend(k,icrm);
+    }
+  });
+
+  parallel_for( ncrms , YAKL_LAMBDA(int icrm) {
+    crm_output_subcycle_factor(icrm) = crm_output_subcycle_factor(icrm)/((real) nstop);
+  });
+
+  // Convective mass fluxes, fluxes and TKE are history diagnostics (and ECPP
+  // inputs, which always set do_crm_stats)
+  if (!do_crm_stats) { return; }
+
   // for (int k=0; k<plev; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<2>(plev,ncrms) , YAKL_LAMBDA (int k, int icrm) {
@@ -557,18 +694,6 @@ void post_timeloop() {
     crm_output_qp_fall   (l,icrm) = qpfall(k,icrm);
     crm_output_qp_evp    (l,icrm) = qpevp(k,icrm);
     crm_output_qp_src    (l,icrm) = qpsrc(k,icrm);
-
-    crm_output_qt_ls     (l,icrm) = qtend(k,icrm);
-    crm_output_t_ls      (l,icrm) = ttend(k,icrm);
-    if (use_VT) {
-      crm_output_t_vt_ls   (l,icrm) = t_vt_tend(k,icrm);
-      crm_output_q_vt_ls   (l,icrm) = q_vt_tend(k,icrm);
-      crm_output_u_vt_ls   (l,icrm) = u_vt_tend(k,icrm);
-    }
-  });
-
-  parallel_for( ncrms , YAKL_LAMBDA(int icrm) {
-    crm_output_subcycle_factor(icrm) = crm_output_subcycle_factor(icrm)/((real) nstop);
   });
 }
 
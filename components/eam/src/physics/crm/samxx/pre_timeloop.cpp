@@ -323,12 +323,17 @@ void pre_timeloop() {
 
   micro_init();
   sgs_init();
+#ifdef CRM_SINGLE_PRECISION
+  double3d mean_sum("mean_sum",10,nzm,ncrms);
+  yakl::memset(mean_sum,0.);
+#endif
   // for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
     colprec (icrm)=0.0;
     colprecs(icrm)=0.0;
   });
 
+#ifndef CRM_SINGLE_PRECISION
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
@@ -376,6 +381,55 @@ void pre_timeloop() {
     yakl::atomicAdd(qp0(k,icrm) , tmp);
     yakl::atomicAdd(tke0(k,icrm) , sgs_field(0,k,j+offy_s,i+offx_s,icrm));
   });
+#else
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny; j++) {
+  //     for (int i=0; i<nx; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    t(k,j+offy_s,i+offx_s,icrm) = tabs(k,j,i,icrm)+gamaz(k,icrm)-fac_cond*qcl(k,j,i,icrm)-fac_sub*qci(k,j,i,icrm) -
+                                                                 fac_cond*qpl(k,j,i,icrm)-fac_sub*qpi(k,j,i,icrm);
+
+    real tmp = (qpl(k,j,i,icrm)+qpi(k,j,i,icrm))*crm_input_pdel(plev-(k+1),icrm);
+    yakl::atomicAdd(colprec(icrm) , (double) tmp);
+
+    tmp = qpi(k,j,i,icrm)*crm_input_pdel(plev-(k+1),icrm);
+    yakl::atomicAdd(colprecs(icrm) , (double) tmp);
+    yakl::atomicAdd(mean_sum(0,k,icrm) , (double) u(k,j+offy_u,i+offx_u,icrm));
+    yakl::atomicAdd(mean_sum(1,k,icrm) , (double) v(k,j+offy_v,i+offx_v,icrm));
+    yakl::atomicAdd(mean_sum(2,k,icrm) , (double) t(k,j+offy_s,i+offx_s,icrm));
+
+    tmp = t(k,j+offy_s,i+offx_s,icrm)+fac_cond*qpl(k,j,i,icrm)+fac_sub*qpi(k,j,i,icrm);
+    yakl::atomicAdd(mean_sum(3,k,icrm) , (double) tmp);
+    yakl::atomicAdd(mean_sum(4,k,icrm) , (double) tabs(k,j,i,icrm));
+
+    tmp = qv(k,j,i,icrm)+qcl(k,j,i,icrm)+qci(k,j,i,icrm);
+    yakl::atomicAdd(mean_sum(5,k,icrm) , (double) tmp);
+    yakl::atomicAdd(mean_sum(6,k,icrm) , (double) qv(k,j,i,icrm));
+
+    tmp = qcl(k,j,i,icrm) + qci(k,j,i,icrm);
+    yakl::atomicAdd(mean_sum(7,k,icrm) , (double) tmp);
+
+    tmp = qpl(k,j,i,icrm) + qpi(k,j,i,icrm);
+    yakl::atomicAdd(mean_sum(8,k,icrm) , (double) tmp);
+    yakl::atomicAdd(mean_sum(9,k,icrm) , (double) sgs_field(0,k,j+offy_s,i+offx_s,icrm));
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    u0   (k,icrm) = mean_sum(0,k,icrm);
+    v0   (k,icrm) = mean_sum(1,k,icrm);
+    t0   (k,icrm) = mean_sum(2,k,icrm);
+    t00  (k,icrm) = mean_sum(3,k,icrm);
+    tabs0(k,icrm) = mean_sum(4,k,icrm);
+    q0   (k,icrm) = mean_sum(5,k,icrm);
+    qv0  (k,icrm) = mean_sum(6,k,icrm);
+    qn0  (k,icrm) = mean_sum(7,k,icrm);
+    qp0  (k,icrm) = mean_sum(8,k,icrm);
+    tke0 (k,icrm) = mean_sum(9,k,icrm);
+  });
+#endif
 
   if (use_VT) { VT_diagnose(); }
 
@@ -419,7 +473,7 @@ void pre_timeloop() {
     ustar(icrm) = sqrt(crm_input_tau00(icrm)/rho(0,icrm));
     //z0(icrm) = z0_est(z(icrm,1),bflx(icrm),wnd(icrm),ustar(icrm))
     z0_est(z(0,icrm),bflx(icrm),wnd(icrm),ustar(icrm),z0(icrm));
-    z0(icrm) = max(0.00001,min(1.0,z0(icrm)));
+    z0(icrm) = max((real) 0.00001,min((real) 1.0,z0(icrm)));
     crm_output_subcycle_factor(icrm) = 0.0;
     crm_output_prectend (icrm)=colprec (icrm);
     crm_output_precstend(icrm)=colprecs(icrm);
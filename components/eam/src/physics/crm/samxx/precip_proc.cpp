@@ -49,9 +49,9 @@ void precip_proc(real5d &q, int ind_q, real5d &qp, int ind_qp) {
          qss, accrcg, accrig, tmp, qgg, dq, qsatt, qsat;
 
     if (qn(k,j,i,icrm)+qp(ind_qp,k,j+offy_s,i+offx_s,icrm) > 0.0) {
-      omn = max(0.0,min(1.0,(tabs(k,j,i,icrm)-tbgmin)*a_bg));
-      omp = max(0.0,min(1.0,(tabs(k,j,i,icrm)-tprmin)*a_pr));
-      omg = max(0.0,min(1.0,(tabs(k,j,i,icrm)-tgrmin)*a_gr));
+      omn = max((real) 0.0,min((real) 1.0,(tabs(k,j,i,icrm)-tbgmin)*a_bg));
+      omp = max((real) 0.0,min((real) 1.0,(tabs(k,j,i,icrm)-tprmin)*a_pr));
+      omg = max((real) 0.0,min((real) 1.0,(tabs(k,j,i,icrm)-tgrmin)*a_gr));
 
       if (qn(k,j,i,icrm) > 0.0) {
         qcc = qn(k,j,i,icrm) * omn;
@@ -126,7 +126,7 @@ void precip_proc(real5d &q, int ind_q, real5d &qp, int ind_qp) {
           dq = dq + evapg1(k,icrm)*sqrt(qgg) + evapg2(k,icrm)*pow(qgg,powg2);
         }
         dq = dq * dtn * (q(ind_q,k,j+offy_s,i+offx_s,icrm) /qsatt-1.0);
-        dq = max(-0.5*qp(ind_qp,k,j+offy_s,i+offx_s,icrm),dq);
+        dq = max((real) (-0.5*qp(ind_qp,k,j+offy_s,i+offx_s,icrm)),dq);
         qp(ind_qp,k,j+offy_s,i+offx_s,icrm) = qp(ind_qp,k,j+offy_s,i+offx_s,icrm) + dq;
         q(ind_q,k,j+offy_s,i+offx_s,icrm) = q(ind_q,k,j+offy_s,i+offx_s,icrm) - dq;
         yakl::atomicAdd(qpevp(k,icrm),dq);
@@ -142,7 +142,7 @@ void precip_proc(real5d &q, int ind_q, real5d &qp, int ind_qp) {
     }
 
     dq = qp(ind_qp,k,j+offy_s,i+offx_s,icrm);
-    qp(ind_qp,k,j+offy_s,i+offx_s,icrm)=max(0.0,qp(ind_qp,k,j+offy_s,i+offx_s,icrm));
+    qp(ind_qp,k,j+offy_s,i+offx_s,icrm)=max((real) 0.0,qp(ind_qp,k,j+offy_s,i+offx_s,icrm));
     q(ind_q,k,j+offy_s,i+offx_s,icrm) = q(ind_q,k,j+offy_s,i+offx_s,icrm) + (dq-qp(ind_qp,k,j+offy_s,i+offx_s,icrm));
 
   });
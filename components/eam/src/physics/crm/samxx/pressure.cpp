@@ -12,31 +12,28 @@ void pressure() {
   YAKL_SCOPE( rho           , :: rho );
   YAKL_SCOPE( ncrms         , :: ncrms );
 
-  int npressureslabs = nsubdomains;
-  int nzslab = max(1,nzm/npressureslabs); 
+  // The CRM is a single subdomain, so the pressure slab holds every level and
+  // the vertical solve runs in place on the transformed field.
+  static_assert(nsubdomains == 1, "pressure() assumes a single CRM subdomain");
+  int nzslab = nzm;
   int nx2 = nx+2;
   int ny2 = ny+2*YES3D;
   int constexpr n3i=3*nx_gl/2+1;
   int constexpr n3j=3*ny_gl/2+1;
-  int constexpr fftySize = ny > 4 ? ny : 4;
 
-  real4d f ("f" , nzslab, ny2, nx2, ncrms);
-  real4d ff("ff", nzm,ny2,nx+1,ncrms);
-  real2d a ("a" , nzm, ncrms);
-  real2d c ("c" , nzm, ncrms);
+  ArenaScope arena_scope;
+  real4d f = arena_array<real4d>("f", nzslab, ny2, nx2, ncrms);
+  real2d a = arena_array<real2d>("a", nzm, ncrms);
+  real2d c = arena_array<real2d>("c", nzm, ncrms);
 
-  int iwall = 0;
-  int nypp, jwall;
+  int nypp;
 
   if (RUN2D) {
     nypp = 1;
-    jwall = 0;
   } else {
     nypp = ny+2;
   }
 
-  real2d eign("eign",nypp,nx+1);
-
   press_rhs();
 
   // for (int k=0; k<nzslab; k++) {
@@ -54,38 +51,33 @@ void pressure() {
 
   #else
 
-    realHost2d work  ("work"  ,ny2,nx2);
-    realHost1d ftmp_x("ftmp_x",nx2);
-    realHost1d ftmp_y("ftmp_y",ny2);
-    realHost1d trigxi("trigxi",n3i);
-    realHost1d trigxj("trigxj",n3j);
-    intHost1d  ifaxi ("ifaxi" ,100);
-    intHost1d  ifaxj ("ifaxj" ,100);
+    // Twiddles and factors depend only on the global grid; prepare them once
+    static real trigxi[n3i];
+    static real trigxj[n3j];
+    static int  ifaxi[100];
+    static int  ifaxj[100];
+    static bool fft_prepared = false;
+    if (!fft_prepared) {
+      fftfax_crm( nx_gl , ifaxi , trigxi );
+      if (RUN3D) fftfax_crm( ny_gl , ifaxj , trigxj );
+      fft_prepared = true;
+    }
+
+    // fft991_crm transforms "lot" strided vectors per call: all CRMs of a row
+    // in x, and every (i,icrm) column of a level in y
+    realHost1d work("work",(max(nx_gl,ny_gl)+1)*(nx_gl+1)*ncrms);
     realHost4d fHost = f.createHostCopy();
 
     yakl::fence();
 
-    fftfax_crm( nx_gl , ifaxi.data() , trigxi.data() );
-    if (RUN3D) fftfax_crm( ny_gl , ifaxj.data() , trigxj.data() );
-
     for (int k = 0 ; k < nzslab ; k++) {
       for (int j = 0 ; j < ny_gl ; j++) {
-        for (int icrm = 0 ; icrm < ncrms ; icrm++) {
-          for (int i=0 ; i < nx2 ; i++) { ftmp_x(i) = fHost(k,j,i,icrm); }
-          fft991_crm( ftmp_x.data() , work.data() , trigxi.data() , ifaxi.data() , 1 , nx2 , nx_gl , 1 , -1 );
-          for (int i=0 ; i < nx2 ; i++) { fHost(k,j,i,icrm) = ftmp_x(i); }
-        }
+        fft991_crm( &fHost(k,j,0,0) , work.data() , trigxi , ifaxi , ncrms , 1 , nx_gl , ncrms , -1 );
       }
     }
     if (RUN3D) {
       for (int k = 0 ; k < nzslab ; k++) {
-        for (int i = 0 ; i < nx_gl+1 ; i++) {
-          for (int icrm = 0 ; icrm < ncrms ; icrm++) {
-            for (int j=0 ; j < ny2 ; j++) { ftmp_y(j) = fHost(k,j,i,icrm); }
-            fft991_crm( ftmp_y.data() , work.data() , trigxj.data() , ifaxj.data() , 1 , nx2 , ny_gl , 1 , -1);
-            for (int j=0 ; j < ny2 ; j++) { fHost(k,j,i,icrm) = ftmp_y(j); }
-          }
-        }
+        fft991_crm( &fHost(k,0,0,0) , work.data() , trigxj , ifaxj , nx2*ncrms , 1 , ny_gl , (nx_gl+1)*ncrms , -1 );
       }
     }
 
@@ -93,14 +85,6 @@ void pressure() {
 
   #endif
 
-  // for(int k=0; k<nzslab; k++) {
-  //  for(int j=0; j<nypp; j++) {
-  //    for(int i=0; i<nx+1; i++) {
-  //      for(int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    ff(k,j,i,icrm) = f(k,j,i,icrm);
-  });
-
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
@@ -108,9 +92,13 @@ void pressure() {
     c(k,icrm)=rhow(k+1,icrm)/(adz(k,icrm)*adzw(k+1,icrm)*dz(icrm)*dz(icrm));
   });
 
-  //   for (int j=0; j<nypp; j++) {
-  //     for (int i=0; i<nx+1; i++) {
-  parallel_for( SimpleBounds<2>(nypp,nx+1) , YAKL_LAMBDA (int j, int i) {
+  // for (int j=0; j<nypp; j++) {
+  //  for (int i=0; i<nx+1; i++) {
+  //    for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(nypp,nx+1,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    SArray<real,1,nzm-1> alfa;
+    SArray<real,1,nzm-1> beta;
+
     int jt = 0;
     int it = 0;
 
@@ -125,53 +113,33 @@ void pressure() {
     int id=((i+1)+it-0.1)/2.0;
     real factx = 2.0;
     real xi=id;
-    eign(j,i)=(2.0*cos(factx*xnx*xi)-2.0)*ddx2+(2.0*cos(facty*xny*xj)-2.0)*ddy2;
-  });
+    real eign=(2.0*cos(factx*xnx*xi)-2.0)*ddx2+(2.0*cos(facty*xny*xj)-2.0)*ddy2;
 
-  // for (int j=0; j<nypp; j++) {
-  //  for (int i=0; i<nx+1; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nypp,nx+1,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
-    SArray<real,1,nzm-1> alfa;
-    SArray<real,1,nzm-1> beta;
-
-    int jt = 0;
-    int it = 0;
-    int jd=((j+1)+jt-0.1)/2.0;
-    int id=((i+1)+it-0.1)/2.0;
     real b;
     if(id+jd == 0) {
-      b=1.0/(eign(j,i)*rho(0,icrm)-a(0,icrm)-c(0,icrm));
+      b=1.0/(eign*rho(0,icrm)-a(0,icrm)-c(0,icrm));
       alfa(0)=-c(0,icrm)*b;
-      beta(0)=ff(0,j,i,icrm)*b;
+      beta(0)=f(0,j,i,icrm)*b;
     }
     else {
-      b=1.0/(eign(j,i)*rho(0,icrm)-c(0,icrm));
+      b=1.0/(eign*rho(0,icrm)-c(0,icrm));
       alfa(0)=-c(0,icrm)*b;
-      beta(0)=ff(0,j,i,icrm)*b;
+      beta(0)=f(0,j,i,icrm)*b;
     }
 
     real e;
     for(int k=1; k<nzm-1; k++) {
-      e=1.0/(eign(j,i)*rho(k,icrm)-a(k,icrm)-c(k,icrm)+a(k,icrm)*alfa(k-1));
+      e=1.0/(eign*rho(k,icrm)-a(k,icrm)-c(k,icrm)+a(k,icrm)*alfa(k-1));
       alfa(k)=-c(k,icrm)*e;
-      beta(k)=(ff(k,j,i,icrm)-a(k,icrm)*beta(k-1))*e;
+      beta(k)=(f(k,j,i,icrm)-a(k,icrm)*beta(k-1))*e;
     }
-    ff(nzm-1,j,i,icrm)=(ff(nzm-1,j,i,icrm)-a(nzm-1,icrm)*beta(nzm-2))/
-                       (eign(j,i)*rho(nzm-1,icrm)-a(nzm-1,icrm)+a(nzm-1,icrm)*alfa(nzm-2));
+    f(nzm-1,j,i,icrm)=(f(nzm-1,j,i,icrm)-a(nzm-1,icrm)*beta(nzm-2))/
+                       (eign*rho(nzm-1,icrm)-a(nzm-1,icrm)+a(nzm-1,icrm)*alfa(nzm-2));
     for(int k=nzm-2; k>=0; k--) {
-      ff(k,j,i,icrm)=alfa(k)*ff(k+1,j,i,icrm)+beta(k);
+      f(k,j,i,icrm)=alfa(k)*f(k+1,j,i,icrm)+beta(k);
     }
   });
 
-  // for (int k=0; k<nzslab; k++) {
-  //   for (int j=0; j<nypp; j++) {
-  //     for (int i=0; i<nx+1; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    f(k,j,i,icrm) = ff(k,j,i,icrm);
-  });
-
   #ifndef USE_ORIG_FFT
 
     if (RUN3D) { pressure_ffty.inverse_real(f); }
@@ -184,23 +152,13 @@ void pressure() {
 
     if (RUN3D) {
       for (int k = 0 ; k < nzslab ; k++) {
-        for (int i = 0 ; i < nx_gl+1 ; i++) {
-          for (int icrm = 0 ; icrm < ncrms ; icrm++) {
-            for (int j=0 ; j < ny2 ; j++) { ftmp_y(j) = fHost(k,j,i,icrm); }
-            fft991_crm( ftmp_y.data() , work.data() , trigxj.data() , ifaxj.data() , 1 , nx2 , ny_gl , 1 , +1);
-            for (int j=0 ; j < ny2 ; j++) { fHost(k,j,i,icrm) = ftmp_y(j); }
-          }
-        }
+        fft991_crm( &fHost(k,0,0,0) , work.data() , trigxj , ifaxj , nx2*ncrms , 1 , ny_gl , (nx_gl+1)*ncrms , +1 );
       }
     }
 
     for (int k = 0 ; k < nzslab ; k++) {
       for (int j = 0 ; j < ny_gl ; j++) {
-        for (int icrm = 0 ; icrm < ncrms ; icrm++) {
-          for (int i=0 ; i < nx2 ; i++) { ftmp_x(i) = fHost(k,j,i,icrm); }
-          fft991_crm( ftmp_x.data() , work.data() , trigxi.data() , ifaxi.data() , 1 , nx2 , nx_gl , 1 , +1);
-          for (int i=0 ; i < nx2 ; i++) { fHost(k,j,i,icrm) = ftmp_x(i); }
-        }
+        fft991_crm( &fHost(k,j,0,0) , work.data() , trigxi , ifaxi , ncrms , 1 , nx_gl , ncrms , +1 );
       }
     }
 
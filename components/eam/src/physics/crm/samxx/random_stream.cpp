@@ -0,0 +1,35 @@
+
+#include "random_stream.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+RandomStream::RandomStream(int gcol, int stream, int step) {
+  uint32_t key[3] = { (uint32_t) gcol, (uint32_t) stream, (uint32_t) step };
+  dsfmt_init_by_array(&state, key, 3);
+}
+
+
+RandomStream::~RandomStream() {
+  free(buffer);
+}
+
+
+void RandomStream::fill(real *array, int n) {
+  // dSFMT's array fill needs an even size of at least dsfmt_get_min_array_size()
+  // in a 16-byte aligned buffer (see the note on dsfmt_fill_array_close_open)
+  int nfill = std::max( dsfmt_get_min_array_size() , n + n%2 );
+  if (buffer_size < nfill) {
+    free(buffer);
+    void *mem;
+    if (posix_memalign(&mem, 16, nfill*sizeof(double)) != 0) {
+      std::cout << "RandomStream::fill: could not allocate " << nfill << " aligned doubles" << std::endl;
+      exit(-1);
+    }
+    buffer = static_cast<double *>(mem);
+    buffer_size = nfill;
+  }
+  dsfmt_fill_array_close_open(&state, buffer, nfill);
+  for (int i=0; i<n; i++) { array[i] = buffer[i]; }
+}
+
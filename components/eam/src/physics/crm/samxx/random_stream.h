@@ -0,0 +1,40 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include "dSFMT.h"
+
+// Reproducible random number streams backed by the dSFMT generator in
+// share/RandNum. A stream is keyed by (global column id, stream id, step)
+// instead of by rank or by the order of earlier draws, so the numbers a CRM
+// column sees do not depend on the PE layout or on which other columns share
+// its rank, and a restarted run draws the same numbers as a continuous one.
+// Each column owns its stream, so columns can be filled independently.
+// dSFMT runs on the host; callers draw there and copy to the device once.
+
+// Stream ids - one per stochastic component so their numbers never overlap
+enum {
+  RANDOM_STREAM_PERTURB = 1,   // near-surface LSE perturbations in setperturb()
+  RANDOM_STREAM_DEBUG   = 2    // roundoff perturbations in perturb_arrays()
+};
+
+class RandomStream {
+public:
+  RandomStream(int gcol, int stream, int step);
+  ~RandomStream();
+  RandomStream(RandomStream const &) = delete;
+  RandomStream &operator=(RandomStream const &) = delete;
+
+  // Fill array(0:n-1) with uniform numbers in [0,1) using dSFMT's bulk array
+  // generator. csm_share builds dSFMT.c without HAVE_SSE2, so E3SM gets the
+  // portable path; the standalone test build enables SSE2 on x86_64. Both
+  // paths produce the same numbers.
+  void fill(real *array, int n);
+
+private:
+  // dSFMT's SSE2 path needs the state and the fill buffer 16-byte aligned
+  alignas(16) dsfmt_t state;
+  double *buffer      = nullptr;
+  int     buffer_size = 0;
+};
+
@@ -26,7 +26,16 @@ void DEBUG_SCALAR(T var) {
   std::cout << std::setprecision(16) << std::scientific << var << std::endl;
 }
 
-typedef double real;
+// CRM_SINGLE_PRECISION stores the CRM state and diagnostics in float. Horizontal
+// and column sums that feed the GCM tendencies are still accumulated in double:
+// under this flag pre_timeloop, diagnose and post_timeloop atomically add into
+// double temporaries, while the double build keeps its plain atomic reductions.
+#ifdef CRM_SINGLE_PRECISION
+  typedef float  real;
+#else
+  typedef double real;
+#endif
+
 
 int  constexpr crm_nx     = CRM_NX;
 int  constexpr crm_ny     = CRM_NY;
@@ -87,6 +96,7 @@ int  constexpr dimy1_sstxy = 1-YES3D ;
 int  constexpr dimy2_sstxy = ny      ;
 int  constexpr ncols = nx*ny;
 int  constexpr nadams = 3;
+int  constexpr max_ncycle = 4;          // upper bound on kurant() subcycles per step
 
 int  constexpr dimx_u     = dimx2_u - dimx1_u   + 1;
 int  constexpr dimx_v     = dimx2_v - dimx1_v   + 1;
@@ -291,6 +301,10 @@ typedef yakl::Array<real,5,yakl::memDevice,yakl::styleC> real5d;
 typedef yakl::Array<real,6,yakl::memDevice,yakl::styleC> real6d;
 typedef yakl::Array<real,7,yakl::memDevice,yakl::styleC> real7d;
 
+typedef yakl::Array<double,1,yakl::memDevice,yakl::styleC> double1d;
+typedef yakl::Array<double,2,yakl::memDevice,yakl::styleC> double2d;
+typedef yakl::Array<double,3,yakl::memDevice,yakl::styleC> double3d;
+
 typedef yakl::Array<int,1,yakl::memDevice,yakl::styleC> int1d;
 typedef yakl::Array<int,2,yakl::memDevice,yakl::styleC> int2d;
 typedef yakl::Array<int,3,yakl::memDevice,yakl::styleC> int3d;
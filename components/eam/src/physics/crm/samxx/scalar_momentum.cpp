@@ -31,18 +31,19 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
 
    real constexpr pi = 3.14159;
    
-   real1d k_arr("k_arr",nx);
-   real2d dz_loc("dz_loc",nzm+1,ncrms);
-   real3d scalar_wind_avg("scalar_wind_avg",nzm,ny,ncrms);
-   real3d shear("shear",nzm,ny,ncrms);
-   real4d a("a",nzm,ny,nx,ncrms);
-   real4d b("b",nzm,ny,nx,ncrms);
-   real4d c("c",nzm,ny,nx,ncrms);
-   real4d w_i("w_i",nzm,ny,nx,ncrms);
-   real4d pgf("pgf",nzm,ny,nx,ncrms);
+   ArenaScope arena_scope;
+   real1d k_arr = arena_array<real1d>("k_arr",nx);
+   real2d dz_loc = arena_array<real2d>("dz_loc",nzm+1,ncrms);
+   real3d scalar_wind_avg = arena_array<real3d>("scalar_wind_avg",nzm,ny,ncrms);
+   real3d shear = arena_array<real3d>("shear",nzm,ny,ncrms);
+   real4d a = arena_array<real4d>("a",nzm,ny,nx,ncrms);
+   real4d b = arena_array<real4d>("b",nzm,ny,nx,ncrms);
+   real4d c = arena_array<real4d>("c",nzm,ny,nx,ncrms);
+   real4d w_i = arena_array<real4d>("w_i",nzm,ny,nx,ncrms);
+   real4d pgf = arena_array<real4d>("pgf",nzm,ny,nx,ncrms);
    int nx2 = nx+2;
-   real4d w_hat("w_hat",nzm,ny,nx2,ncrms);
-   real4d pgf_hat("pgf_hat",nzm,ny,nx2,ncrms);
+   real4d w_hat = arena_array<real4d>("w_hat",nzm,ny,nx2,ncrms);
+   real4d pgf_hat = arena_array<real4d>("pgf_hat",nzm,ny,nx2,ncrms);
 
    // The loop over "y" points is mostly unessary, since ESMT
    // is for 2D CRMs, but it is useful for directly comparing
@@ -252,8 +253,9 @@ void scalar_momentum_tend() {
    YAKL_SCOPE( u_esmt    , :: u_esmt );
    YAKL_SCOPE( v_esmt    , :: v_esmt );
    
-   real4d u_esmt_pgf_3D("u_esmt_pgf_3D",nzm,ny,nx,ncrms);
-   real4d v_esmt_pgf_3D("v_esmt_pgf_3d",nzm,ny,nx,ncrms); 
+   ArenaScope arena_scope;
+   real4d u_esmt_pgf_3D = arena_array<real4d>("u_esmt_pgf_3D",nzm,ny,nx,ncrms);
+   real4d v_esmt_pgf_3D = arena_array<real4d>("v_esmt_pgf_3d",nzm,ny,nx,ncrms);
 
    // Calculate pressure gradient force tendency
    scalar_momentum_pgf(u_esmt,u_esmt_pgf_3D);
@@ -3,6 +3,7 @@
 #include "samxx_const.h"
 #include "YAKL_fft.h"
 #include "vars.h"
+#include "arena.h"
 
 extern "C" void rfft1i(int n, real* wsave, int lensav, int ier);
 extern "C" void rfft1f(int n, int inc, real* r, int lenr, real* wsave, int lensav, real* work, int lenwrk, int ier );
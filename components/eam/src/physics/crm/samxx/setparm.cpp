@@ -52,3 +52,6 @@ extern "C" void setparm() {
 }
 
 
+extern "C" void crm_set_masterproc(bool masterproc_in) {
+  gcm_masterproc = masterproc_in;
+}
@@ -6,3 +6,5 @@
 
 extern "C" void setparm();
 
+extern "C" void crm_set_masterproc(bool masterproc_in);
+
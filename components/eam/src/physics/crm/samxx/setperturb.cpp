@@ -1,39 +1,61 @@
 #include "setperturb.h"
+#include "random_stream.h"
+
 void setperturb() {
+  YAKL_SCOPE( t      , :: t );
+  YAKL_SCOPE( t0     , :: t0 );
+  YAKL_SCOPE( ncrms  , :: ncrms );
   // Add random noise near the surface to help turbulence develop
-  // The random generator is seeded based on the global column id, 
-  // which avoids a problematic sensitivity to pcols.
+  // Each column draws from its own random stream keyed by the global column id,
+  // which avoids a problematic sensitivity to pcols and to the PE layout.
   int  constexpr perturb_num_layers  = 5;    // Number of levels to perturb
   real constexpr perturb_t_magnitude = 1.0;  // perturbation LSE amplitube [K]
+  int  constexpr nrand = perturb_num_layers*ny*nx;
   real factor_xy = 1. / (nx*ny);
-  auto t_host     = t.createHostCopy();
-  auto t0_host    = t0.createHostCopy();
+
+  // dSFMT only runs on the host: draw every column's uniform random numbers
+  // in [0,1) there, then copy them to the device in a single transfer
   auto gcolp_host = gcolp.createHostCopy();
-  // Apply random liquid static energy (LSE) perturbations
+  realHost2d rand_host("rand_host",ncrms,nrand);
   for (int icrm = 0; icrm < ncrms; icrm++) {
-    srand(gcolp_host(icrm)*1000);
-    for (int k = 0; k < perturb_num_layers; k++) {
-      // set perturb_k_scaling so that perturbation magnitude decreases with altitude
-      real perturb_k_scaling = ((real)perturb_num_layers-k) / (real)perturb_num_layers;
-      real t02 = 0;
-      for (int j = 0; j < ny; j++) {
-        for (int i = 0; i < nx; i++) {
-          // Generate a uniform random number in interval (0,1)
-          real rand_perturb = static_cast<double>( rand() ) / static_cast<double>( RAND_MAX );
-          // onvert perturbation range from (0,1) to (-1,1)
-          rand_perturb = 1.-2.*rand_perturb;
-          // apply perturbation 
-          t_host(k,j+offy_s,i+offx_s,icrm) = t_host(k,j+offy_s,i+offx_s,icrm) + rand_perturb * perturb_t_magnitude * perturb_k_scaling;
-          // Calculate new average LSE for energy conservation scaling below
-          t02 += t_host(k,j+offy_s,i+offx_s,icrm)*factor_xy;
-        }
-      }
-      for (int j = 0; j < ny; j++) {
-        for (int i = 0; i < nx; i++) {
-          t_host(k,j+offy_s,i+offx_s,icrm) = t_host(k,j+offy_s,i+offx_s,icrm) * t0_host(k,icrm) / t02;
-        }
+    RandomStream stream( gcolp_host(icrm) , RANDOM_STREAM_PERTURB , 0 );
+    stream.fill( &rand_host(icrm,0) , nrand );
+  }
+  real2d rand_dev("rand_dev",ncrms,nrand);
+  rand_host.deep_copy_to(rand_dev);
+
+  // Apply random liquid static energy (LSE) perturbations
+  // for (int k = 0; k < perturb_num_layers; k++) {
+  //  for (int j = 0; j < ny; j++) {
+  //    for (int i = 0; i < nx; i++) {
+  //      for (int icrm = 0; icrm < ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(perturb_num_layers,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    // set perturb_k_scaling so that perturbation magnitude decreases with altitude
+    real perturb_k_scaling = ((real)perturb_num_layers-k) / (real)perturb_num_layers;
+    // convert perturbation range from [0,1) to (-1,1]
+    real rand_perturb = 1.-2.*rand_dev(icrm,(k*ny+j)*nx+i);
+    t(k,j+offy_s,i+offx_s,icrm) = t(k,j+offy_s,i+offx_s,icrm) + rand_perturb * perturb_t_magnitude * perturb_k_scaling;
+  });
+
+  // Calculate new average LSE for energy conservation scaling below
+  real2d t02("t02",perturb_num_layers,ncrms);
+  // for (int k = 0; k < perturb_num_layers; k++) {
+  //  for (int icrm = 0; icrm < ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(perturb_num_layers,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    real tmp = 0;
+    for (int j = 0; j < ny; j++) {
+      for (int i = 0; i < nx; i++) {
+        tmp += t(k,j+offy_s,i+offx_s,icrm)*factor_xy;
       }
     }
-  }
-  t_host.deep_copy_to(t);
+    t02(k,icrm) = tmp;
+  });
+
+  // for (int k = 0; k < perturb_num_layers; k++) {
+  //  for (int j = 0; j < ny; j++) {
+  //    for (int i = 0; i < nx; i++) {
+  //      for (int icrm = 0; icrm < ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(perturb_num_layers,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    t(k,j+offy_s,i+offx_s,icrm) = t(k,j+offy_s,i+offx_s,icrm) * t0(k,icrm) / t02(k,icrm);
+  });
 }
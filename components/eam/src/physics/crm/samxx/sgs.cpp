@@ -1,7 +1,7 @@
 
 #include "sgs.h"
 
-void kurant_sgs(real &cfl) {
+void kurant_sgs(real &cfl, real1d &cfl_crm) {
   YAKL_SCOPE( sgs_field_diag , :: sgs_field_diag );
   YAKL_SCOPE( dz             , :: dz );
   YAKL_SCOPE( dy             , :: dy );
@@ -37,6 +37,7 @@ void kurant_sgs(real &cfl) {
     real ydir = 0.5*tkhmax(k,icrm)*grdf_y(k,icrm)*dt/(dy*dy)*YES3D;
     real zdir = 0.5*tkhmax(k,icrm)*grdf_z(k,icrm)*dt/(dztmp*dztmp);
     tkhmax(k,icrm) = max( max( xdir , ydir ) , zdir );
+    yakl::atomicMax( cfl_crm(icrm) , tkhmax(k,icrm) );
   });
 
   // Perform a max reduction over tkhmax
@@ -153,8 +154,8 @@ void sgs_init() {
     parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
       real tmp1 = (adz(k,icrm)*dz(icrm));
       real tmp2 = (adz(k,icrm)*dz(icrm));
-      grdf_x(k,icrm) = min( 16.0, dx*dx/(tmp1*tmp1));
-      grdf_y(k,icrm) = min( 16.0, dy*dy/(tmp2*tmp2));
+      grdf_x(k,icrm) = min( (real) 16.0, dx*dx/(tmp1*tmp1));
+      grdf_y(k,icrm) = min( (real) 16.0, dy*dy/(tmp2*tmp2));
       grdf_z(k,icrm) = 1.0;
     });
   }
@@ -1,4 +1,4 @@
 #!/bin/bash
 
-rm -rf CMakeCache.txt CMakeFiles cmake_install.cmake CTestTestfile.cmake Makefile fortran.exe cpp.exe cpp2d cpp3d fortran2d fortran3d Testing yakl
+rm -rf CMakeCache.txt CMakeFiles cmake_install.cmake CTestTestfile.cmake Makefile fortran.exe cpp.exe cpp2d cpp3d cpp3d_sp cpp3d_nofma fortran2d fortran3d Testing yakl
 
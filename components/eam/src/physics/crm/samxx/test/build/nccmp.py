@@ -10,16 +10,22 @@ import netCDF4, sys, numpy as np
 # conda create --name crm_test_env --channel conda-forge netcdf4 numpy
 #
 # Usage:
-# python nccmp.py file1.nc file2.nc
+# python nccmp.py file1.nc file2.nc [tol]
+#
+# With the optional tol argument the exit status is non-zero if the relative
+# inf-norm of any variable exceeds tol.
 #
 ################################################################################
 ################################################################################
 
 # Complain if there aren't two arguments
 if (len(sys.argv) < 3) :
-  print("Usage: python nccmp.py file1.nc file2.nc")
+  print("Usage: python nccmp.py file1.nc file2.nc [tol]")
   sys.exit(1)
 
+tol = float(sys.argv[3]) if len(sys.argv) > 3 else None
+nfail = 0
+
 # Open the two files
 nc1 = netCDF4.Dataset(sys.argv[1])
 nc2 = netCDF4.Dataset(sys.argv[2])
@@ -61,8 +67,11 @@ for v in nc1.variables.keys() :
 
     # skip lines that are all zeros
     if norm2==0 and normi==0 and avg_abs_err==0 and max_abs_err==0: continue
+    if (tol is not None and normi > tol) : nfail = nfail + 1
 
     # Print to terminal
     print(f'{v:<20}:  {norm2:20.10e}  {normi:20.10e}  {avg_abs_err:20.10e}  {max_abs_err:20.10e}')
 
-
+if (nfail > 0) :
+  print(f'\n{nfail} variables exceed a relative inf-norm of {tol}')
+  sys.exit(1)
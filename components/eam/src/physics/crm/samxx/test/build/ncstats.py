@@ -0,0 +1,73 @@
+import netCDF4, sys, numpy as np
+################################################################################
+################################################################################
+# ncstats.py: A statistics-based NetCDF comparison tool for runs that are not
+# expected to match bit-for-bit, e.g. a single precision CRM build against the
+# double precision one. For every float variable it compares the mean and the
+# standard deviation of the field. A variable fails when its mean differs by
+# more than tol standard deviations of the reference, or when its standard
+# deviation differs by more than a relative tol. The first file is the
+# reference. The exit status is non-zero if any variable fails.
+#
+# Usage:
+# python ncstats.py reference.nc test.nc [tol]
+#
+################################################################################
+################################################################################
+
+# Complain if there aren't two arguments
+if (len(sys.argv) < 3) :
+  print("Usage: python ncstats.py reference.nc test.nc [tol]")
+  sys.exit(1)
+
+tol = 0.05
+if (len(sys.argv) > 3) : tol = float(sys.argv[3])
+
+# Open the two files
+nc1 = netCDF4.Dataset(sys.argv[1])
+nc2 = netCDF4.Dataset(sys.argv[2])
+
+# Print column header
+print(f"{'Var Name':<20}:  {'ref mean':<16}  {'test mean':<16}  {'mean diff/std':<16}  {'std rel diff':<16}")
+
+nfail = 0
+################################################################################
+#Loop through all variables
+################################################################################
+for v in nc1.variables.keys() :
+
+  # Only compare floats
+  if (nc2.variables[v].dtype == np.float64 or nc2.variables[v].dtype == np.float32) :
+
+    # Grab the variables in double so the statistics themselves are exact enough
+    a1 = np.asarray(nc1.variables[v][:], dtype=np.float64)
+    a2 = np.asarray(nc2.variables[v][:], dtype=np.float64)
+
+    mean1 = np.mean(a1)
+    mean2 = np.mean(a2)
+    std1  = np.std (a1)
+    std2  = np.std (a2)
+
+    # Constant fields are compared against their magnitude instead
+    scale = std1
+    if (scale == 0) : scale = abs(mean1)
+    if (scale == 0) : scale = 1
+
+    mean_diff = abs(mean2-mean1) / scale
+    std_diff  = abs(std2 -std1 ) / scale
+
+    # skip lines that are identical
+    if mean_diff==0 and std_diff==0: continue
+
+    status = ''
+    if (mean_diff > tol or std_diff > tol) :
+      status = '  FAIL'
+      nfail = nfail + 1
+
+    # Print to terminal
+    print(f'{v:<20}:  {mean1:16.8e}  {mean2:16.8e}  {mean_diff:16.8e}  {std_diff:16.8e}{status}')
+
+if (nfail > 0) :
+  print(f'\n{nfail} variables differ by more than {tol}')
+  sys.exit(1)
+print(f'\nAll variables agree to within {tol}')
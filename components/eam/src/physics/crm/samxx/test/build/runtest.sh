@@ -12,6 +12,13 @@ make -j8 || exit -1
 ################################################################################
 ################################################################################
 
+printf "\n\nRunning random stream test\n\n"
+
+./random_stream/random_stream_test || exit -1
+
+################################################################################
+################################################################################
+
 printf "\n\nRunning 2-D tests\n\n"
 
 printf "\nRunning Fortran code\n\n"
@@ -49,5 +56,38 @@ cd ..
 printf "\nComparing results\n\n"
 python nccmp.py fortran3d/fortran_output_000001.nc cpp3d/cpp_output_000001.nc || exit -1
 
+printf "\nRunning C++ code without FMA contraction, split and fused SGS diffusion\n\n"
+cd cpp3d_nofma
+rm -f cpp_output_000001.nc cpp_fused_output_000001.nc
+mpirun -n $ntasks ./cpp3d_nofma || exit -1
+mpirun -n $ntasks ./cpp3d_nofma fused || exit -1
+cd ..
+
+printf "\nComparing fused SGS diffusion to the split kernels bit for bit\n\n"
+python nccmp.py cpp3d_nofma/cpp_output_000001.nc cpp3d_nofma/cpp_fused_output_000001.nc 0 || exit -1
+
+printf "\nRunning C++ code with MMF_stats_interval=1\n\n"
+cd cpp3d
+rm -f cpp_stats_output_000001.nc
+mpirun -n $ntasks ./cpp3d stats 1 || exit -1
+cd ..
+
+printf "\nComparing MMF_stats_interval=1 to the default run bit for bit\n\n"
+python nccmp.py cpp3d/cpp_output_000001.nc cpp3d/cpp_stats_output_000001.nc 0 || exit -1
+
+################################################################################
+################################################################################
+
+printf "\n\nRunning 3-D single precision test\n\n"
+
+printf "\nRunning C++ code in single precision\n\n"
+cd cpp3d_sp
+rm -f cpp_output_000001.nc
+mpirun -n $ntasks ./cpp3d_sp || exit -1
+cd ..
+
+printf "\nComparing statistics against double precision\n\n"
+python ncstats.py cpp3d/cpp_output_000001.nc cpp3d_sp/cpp_output_000001.nc || exit -1
+
 ################################################################################
 ################################################################################
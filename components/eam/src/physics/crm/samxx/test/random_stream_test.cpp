@@ -0,0 +1,68 @@
+
+#include "random_stream.h"
+#include <iostream>
+#include <vector>
+
+// Checks that a RandomStream key (global column id, stream id, step) always
+// draws the same numbers, that changing any part of the key changes them, and
+// that the draws lie in [0,1). Run by build/runtest.sh.
+
+std::vector<real> draw(int gcol, int stream, int step, int n) {
+  std::vector<real> r(n);
+  RandomStream s(gcol, stream, step);
+  s.fill(r.data(), n);
+  return r;
+}
+
+
+int main() {
+  int nfail = 0;
+  // odd and larger than dsfmt_get_min_array_size(), as in setperturb()
+  int n = 5*32*32 + 1;
+
+  auto ref = draw(17, RANDOM_STREAM_PERTURB, 3, n);
+  for (int i=0; i<n; i++) {
+    if (ref[i] < 0 || ref[i] >= 1) {
+      std::cout << "draw " << i << " = " << ref[i] << " is outside [0,1)" << std::endl;
+      nfail++;
+      break;
+    }
+  }
+
+  if (draw(17, RANDOM_STREAM_PERTURB, 3, n) != ref) {
+    std::cout << "the same key did not reproduce its draws" << std::endl;
+    nfail++;
+  }
+
+  // A stream refilled with a larger buffer continues its sequence
+  RandomStream s(17, RANDOM_STREAM_PERTURB, 3);
+  std::vector<real> r(n);
+  s.fill(r.data(), 3);
+  s.fill(r.data(), n);
+  if (r == ref) {
+    std::cout << "a second fill repeated the first draws" << std::endl;
+    nfail++;
+  }
+
+  int keys[3][3] = { {18, RANDOM_STREAM_PERTURB, 3} ,
+                     {17, RANDOM_STREAM_DEBUG  , 3} ,
+                     {17, RANDOM_STREAM_PERTURB, 4} };
+  for (auto &key : keys) {
+    auto other = draw(key[0], key[1], key[2], n);
+    int nsame = 0;
+    for (int i=0; i<n; i++) { if (other[i] == ref[i]) nsame++; }
+    if (nsame > 0) {
+      std::cout << "key (" << key[0] << "," << key[1] << "," << key[2] << ") shares " << nsame
+                << " draws with key (17," << RANDOM_STREAM_PERTURB << ",3)" << std::endl;
+      nfail++;
+    }
+  }
+
+  if (nfail > 0) {
+    std::cout << "random_stream_test: FAIL" << std::endl;
+    return -1;
+  }
+  std::cout << "random_stream_test: PASS" << std::endl;
+  return 0;
+}
+
@@ -17,6 +17,9 @@ void timeloop() {
   do {
     nstep = nstep + 1;
 
+    // Per-call temporaries are scoped; this just guards against a leaked mark.
+    arena_reset();
+
     //------------------------------------------------------------------
     //  Check if the dynamical time step should be decreased
     //  to handle the cases when the flow being locally linearly unstable
@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "vars.h"
+#include "arena.h"
 #include "kurant.h"
 #include "abcoefs.h"
 #include "zero.h"
@@ -212,25 +212,25 @@ void tke_full(real5d &tke, int ind_tke, real5d &tk, int ind_tk, real5d &tkh, int
     if (buoy_sgs <= 0.0) {
       smix = grd;
     } else {
-      smix = min(grd,max(0.1*grd, sqrt(0.76*tk(ind_tk,k,j+offy_d,i+offx_d,icrm)/Ck/sqrt(buoy_sgs+1.e-10))));
+      smix = min(grd,(real) max(0.1*grd, sqrt(0.76*tk(ind_tk,k,j+offy_d,i+offx_d,icrm)/Ck/sqrt(buoy_sgs+1.e-10))));
     }
     ratio = smix/grd;
     Cee = Ce1+Ce2*ratio;
     if (dosmagor) {
-      tk(ind_tk,k,j+offy_d,i+offx_d,icrm) = sqrt(Ck*Ck*Ck/Cee*max(0.0,def2(k,j,i,icrm)-Pr*buoy_sgs))*smix*smix;
+      tk(ind_tk,k,j+offy_d,i+offx_d,icrm) = sqrt(Ck*Ck*Ck/Cee*max((real) 0.0,def2(k,j,i,icrm)-Pr*buoy_sgs))*smix*smix;
       tmp1 = tk(ind_tk,k,j+offy_d,i+offx_d,icrm)/(Ck*smix);
       tke(ind_tke,k,j+offy_s,i+offx_s,icrm) = tmp1*tmp1;
       a_prod_sh = (tk(ind_tk,k,j+offy_d,i+offx_d,icrm)+0.001)*def2(k,j,i,icrm);
       a_prod_bu = 0.5*( a_prod_bu_vert(k,j,i,icrm) + a_prod_bu_vert(k+1,j,i,icrm) );
       a_diss = a_prod_sh+a_prod_bu;
     } else {
-      tke(ind_tke,k,j+offy_s,i+offx_s,icrm) = max(0.0,tke(ind_tke,k,j+offy_s,i+offx_s,icrm));
+      tke(ind_tke,k,j+offy_s,i+offx_s,icrm) = max((real) 0.0,tke(ind_tke,k,j+offy_s,i+offx_s,icrm));
       a_prod_sh = (tk(ind_tk,k,j+offy_d,i+offx_d,icrm)+0.001)*def2(k,j,i,icrm);
       a_prod_bu = 0.5*( a_prod_bu_vert(k,j,i,icrm) + a_prod_bu_vert(k+1,j,i,icrm) );
       // cap the diss rate (useful for large time steps)
       a_diss = min(tke(ind_tke,k,j+offy_s,i+offx_s,icrm)/(4.0*dt),Cee/smix*pow(tke(ind_tke,k,j+offy_s,i+offx_s,icrm),1.5));
-      tke(ind_tke,k,j+offy_s,i+offx_s,icrm) = max(0.0,tke(ind_tke,k,j+offy_s,i+offx_s,icrm)+
-                                                      dtn*(max(0.0,a_prod_sh+a_prod_bu)-a_diss));
+      tke(ind_tke,k,j+offy_s,i+offx_s,icrm) = max((real) 0.0,tke(ind_tke,k,j+offy_s,i+offx_s,icrm)+
+                                                      dtn*(max((real) 0.0,a_prod_sh+a_prod_bu)-a_diss));
       tk(ind_tk,k,j+offy_d,i+offx_d,icrm)  = Ck*smix*sqrt(tke(ind_tke,k,j+offy_s,i+offx_s,icrm));
     }
     tk(ind_tk,k,j+offy_d,i+offx_d,icrm)  = min(tk(ind_tk,k,j+offy_d,i+offx_d,icrm),tkmax);
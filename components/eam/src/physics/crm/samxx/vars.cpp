@@ -1,5 +1,7 @@
 
 #include "vars.h"
+#include "arena.h"
+#include "kurant.h"
 
 void allocate() {
   t00              = real2d( "t00                "      , nzm, ncrms);
@@ -25,8 +27,8 @@ void allocate() {
   ustar            = real1d( "ustar              "           , ncrms);
   wnd              = real1d( "wnd                "           , ncrms);
   qtot             = real2d( "qtot               "    ,    20, ncrms);
-  colprec          = real1d( "colprec            "           , ncrms);
-  colprecs         = real1d( "colprecs           "           , ncrms);
+  colprec          = double1d( "colprec          "           , ncrms);
+  colprecs         = double1d( "colprecs         "           , ncrms);
   bflx             = real1d( "bflx               "           , ncrms);
   flag_top         = int3d ( "flag_top        " ,   ny  , nx , ncrms);  
   accrsc           = real2d( "accrsc          " , nzm, ncrms);
@@ -67,6 +69,9 @@ void allocate() {
   longitude0       = real1d( "longitude0      " , ncrms ); 
   latitude0        = real1d( "latitude0       " , ncrms ); 
   z0               = real1d( "z0              " , ncrms ); 
+  ncycle_crm       = int1d ( "ncycle_crm      " , ncrms );
+  ncycle_crm_max   = int1d ( "ncycle_crm_max  " , ncrms );
+  ncycle_hist      = int1d ( "ncycle_hist     " , max_ncycle+1 );
   uhl              = real1d( "uhl             " , ncrms ); 
   vhl              = real1d( "vhl             " , ncrms ); 
   taux0            = real1d( "taux0           " , ncrms ); 
@@ -248,6 +253,10 @@ void allocate() {
   yakl::memset(longitude0        ,0.);
   yakl::memset(latitude0         ,0.);
   yakl::memset(z0                ,0.);
+  yakl::memset(ncycle_crm        ,0);
+  yakl::memset(ncycle_crm_max    ,0);
+  yakl::memset(ncycle_hist       ,0);
+  ncycle_batch_steps = 0;
   yakl::memset(uhl               ,0.);
   yakl::memset(vhl               ,0.);
   yakl::memset(taux0             ,0.);
@@ -382,6 +391,8 @@ void allocate() {
   yakl::memset(t_vt              ,0.);
   yakl::memset(q_vt              ,0.);
   yakl::memset(u_vt              ,0.);
+
+  arena_allocate();
 }
 
 
@@ -477,6 +488,9 @@ void init_values() {
 
 
 void finalize() {
+  kurant_report();
+  kurant_save();
+
   t00              = real2d();
   tln              = real2d();
   qln              = real2d();
@@ -500,8 +514,8 @@ void finalize() {
   ustar            = real1d();
   wnd              = real1d();
   qtot             = real2d();
-  colprec          = real1d();
-  colprecs         = real1d();
+  colprec          = double1d();
+  colprecs         = double1d();
   bflx             = real1d();
   flag_top         = int3d ();  
   accrsc           = real2d();
@@ -532,6 +546,9 @@ void finalize() {
   longitude0       = real1d(); 
   latitude0        = real1d(); 
   z0               = real1d(); 
+  ncycle_crm       = int1d();
+  ncycle_crm_max   = int1d();
+  ncycle_hist      = int1d();
   uhl              = real1d(); 
   vhl              = real1d(); 
   taux0            = real1d(); 
@@ -674,6 +691,8 @@ void finalize() {
   vt_fftx.cleanup();
   vt_ffty.cleanup();
   esmt_fftx.cleanup();
+
+  arena_finalize();
 }
 
 
@@ -1715,8 +1734,8 @@ real2d mdi_crm         ;
 real1d ustar           ;
 real1d wnd             ;
 real2d qtot            ;
-real1d colprec         ;
-real1d colprecs        ;
+double1d colprec       ;
+double1d colprecs      ;
 real1d bflx            ;
 
 real1d crm_input_bflxls; 
@@ -1835,6 +1854,10 @@ int ncrms;
 int  nstep                    ;
 int  ncycle                   ;
 int  icycle                   ;
+int1d ncycle_crm              ;
+int1d ncycle_crm_max          ;
+int1d ncycle_hist             ;
+long ncycle_batch_steps       ;
 int  na, nb, nc               ;
 real at, bt, ct               ;
 real dtn                      ;
@@ -1850,6 +1873,7 @@ int  rankse                   ;
 int  ranksw                   ;
 bool dompi                    ;
 bool masterproc               ;
+bool gcm_masterproc           = false;
 bool dostatis                 ;
 bool dostatisrad              ;
 int  nstatis                  ;
@@ -1958,6 +1982,9 @@ bool crm_accel_uv;
 bool use_crm_accel;
 real crm_accel_factor;
 
+bool use_fused_diffusion;
+bool do_crm_stats;
+
 real factor_xy;
 real factor_xyt;
 real idt_gl;
@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "YAKL_fft.h"
+#include "random_stream.h"
 
 
 void allocate();
@@ -14,10 +15,21 @@ void init_values();
 void finalize();
 
 
-inline void perturb(real1d &arr, double mag) {
+// Number of perturb() calls so far, used as the step of the next debug stream
+inline int perturb_ncall() {
+  static int ncall = 0;
+  return ncall++;
+}
+
+
+// Each call draws from the next debug stream, so perturb_arrays() is reproducible
+template <class T>
+inline void perturb(T &arr, double mag) {
+  RandomStream stream( 0 , RANDOM_STREAM_DEBUG , perturb_ncall() );
+  realHost1d r("r",arr.get_totElems());
+  stream.fill( r.data() , arr.get_totElems() );
   for (int i=0; i<arr.get_totElems(); i++) {
-    double r = static_cast <double> (rand()) / static_cast <double> (RAND_MAX);
-    arr.data()[i] *= (1.0 + r*mag);
+    arr.data()[i] *= (1.0 + r(i)*mag);
   }
 }
 
@@ -118,6 +130,15 @@ extern int ncrms;
 extern int  nstep                    ;
 extern int  ncycle                   ;
 extern int  icycle                   ;
+// Substeps each CRM needs for its own CFL, summed over the crm() call and at
+// most on one step, and how often each count occurred (index max_ncycle also
+// counts overflows; MMF_NCYCLE_STATS only). ncycle is the maximum over the
+// CRMs of this call and is what every one of them runs; the GCM batches CRMs
+// of similar need (use_MMF_ncycle_batches) to narrow the spread.
+extern int1d ncycle_crm              ;
+extern int1d ncycle_crm_max          ;
+extern int1d ncycle_hist             ;
+extern long ncycle_batch_steps       ;
 extern int  na, nb, nc               ;
 extern real at, bt, ct               ;
 extern real dtn                      ;
@@ -133,6 +154,10 @@ extern int  rankse                   ;
 extern int  ranksw                   ;
 extern bool dompi                    ;
 extern bool masterproc               ;
+// masterproc is SAM's own rank test and is true on every task in the MMF.
+// gcm_masterproc is the GCM's master task, set by crm_set_masterproc; it
+// gates diagnostic output.
+extern bool gcm_masterproc           ;
 extern bool dostatis                 ;
 extern bool dostatisrad              ;
 extern int  nstatis                  ;
@@ -241,6 +266,9 @@ extern bool crm_accel_uv;
 extern bool use_crm_accel;
 extern real crm_accel_factor;
 
+extern bool use_fused_diffusion;
+extern bool do_crm_stats;
+
 extern real4d tabs            ;
 extern real4d qv              ;
 extern real4d qcl             ;
@@ -421,8 +449,8 @@ extern real2d mdi_crm         ;
 extern real1d ustar           ;
 extern real1d wnd             ;
 extern real2d qtot            ;
-extern real1d colprec         ;
-extern real1d colprecs        ;
+extern double1d colprec       ;
+extern double1d colprecs      ;
 extern real1d bflx            ;
 
 extern real1d crm_input_bflxls; 
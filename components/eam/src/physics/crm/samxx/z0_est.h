@@ -11,7 +11,7 @@ YAKL_INLINE void z0_est(real z, real bflx, real wnd, real ustar, real &z0) {
   real bm = 19.3;
   real c1 = 3.14159/2.0 - 3.0*log(2.0);
   real rlmo = -bflx*vonk/(ustar*ustar*ustar+eps);
-  real zeta = min(1.0,z*rlmo);
+  real zeta = min((real) 1.0,z*rlmo);
 
   real x;
   real psi1;
@@ -23,7 +23,7 @@ YAKL_INLINE void z0_est(real z, real bflx, real wnd, real ustar, real &z0) {
     psi1 = 2.0*log(1.0+x) + log(1.0+x*x) -2.0*atan(x) + c1;
   }
 
-  real lnz = max(0.0, vonk*wnd/(ustar+eps) +psi1);
+  real lnz = max((real) 0.0, vonk*wnd/(ustar+eps) +psi1);
 
   z0 = z*exp(-lnz);
 }
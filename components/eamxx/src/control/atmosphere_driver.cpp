@@ -222,6 +222,14 @@ void AtmosphereDriver::create_atm_processes()
   auto& atm_proc_params = m_atm_params.sublist("atmosphere_processes");
   atm_proc_params.rename("EAMxx");
   atm_proc_params.set("Logger",m_atm_logger);
+
+  // If requested, create the state hash that the atm procs will update incrementally
+  m_state_hash_nstep = m_atm_params.sublist("driver_options").get<int>("incremental_bfb_hash_nstep",0);
+  if (m_state_hash_nstep>0) {
+    m_state_hash = std::make_shared<bfbhash::IncrementalStateHash>();
+    atm_proc_params.set("IncrementalStateHash",m_state_hash);
+  }
+
   m_atm_process_group = std::make_shared<AtmosphereProcessGroup>(m_atm_comm,atm_proc_params);
 
   m_ad_status |= s_procs_created;
@@ -1617,6 +1625,15 @@ void AtmosphereDriver::run (const int dt) {
   // Update current time stamps
   m_current_ts += dt;
 
+  // Print the global state hash, if requested. This is cheap, since the atm
+  // procs have only rehashed their computed fields along the way.
+  if (m_state_hash && m_current_ts.get_num_steps() % m_state_hash_nstep == 0) {
+    const auto gstate = m_state_hash->global_state(m_atm_comm.mpi_comm());
+    if (m_atm_comm.am_i_root())
+      fprintf(stderr, "bfbhash> %14d %16lx (%s)\n",
+              m_current_ts.get_num_steps(), gstate, "EAMxx-state");
+  }
+
   // Update output streams
   m_atm_logger->debug("[EAMxx::run] running output managers...");
   for (auto& out_mgr : m_output_managers) {
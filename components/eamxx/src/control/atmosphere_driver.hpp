@@ -6,6 +6,7 @@
 #include "share/field/field_manager.hpp"
 #include "share/grid/grids_manager.hpp"
 #include "share/util/scream_time_stamp.hpp"
+#include "share/util/scream_bfbhash.hpp"
 #include "share/scream_types.hpp"
 #include "share/io/scream_output_manager.hpp"
 #include "share/io/scorpio_input.hpp"
@@ -224,6 +225,11 @@ protected:
   // The logger to be used throughout the ATM to log message
   std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
 
+  // Running hash of the atm state, updated by the atm procs as they run,
+  // and printed every m_state_hash_nstep steps (if >0)
+  std::shared_ptr<bfbhash::IncrementalStateHash> m_state_hash;
+  int                                       m_state_hash_nstep = 0;
+
   // Some status flags, used to make sure we call the init functions in the right order
   static constexpr int s_comm_set       =    1;
   static constexpr int s_params_set     =    2;
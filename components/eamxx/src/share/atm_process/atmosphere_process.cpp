@@ -63,6 +63,10 @@ AtmosphereProcess (const ekat::Comm& comm, const ekat::ParameterList& params)
       m_params.get<bool>("enable_column_conservation_checks", false);
 
   m_internal_diagnostics_level = m_params.get<int>("internal_diagnostics_level", 0);
+
+  if (m_params.isParameter("IncrementalStateHash")) {
+    m_state_hash = m_params.get<std::shared_ptr<bfbhash::IncrementalStateHash>>("IncrementalStateHash");
+  }
 }
 
 void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type) {
@@ -80,6 +84,11 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
     m_start_of_step_fields[fname] = get_field_out(fname).clone();
   }
 
+  if (m_state_hash and this->type()!=AtmosphereProcessType::Group) {
+    // Seed the state hash with everything this process sees
+    update_incremental_state_hash(true);
+  }
+
   if (this->type()!=AtmosphereProcessType::Group) {
     stop_timer (m_timer_prefix + this->name() + "::init");
   }
@@ -133,6 +142,11 @@ void AtmosphereProcess::run (const double dt) {
     run_postcondition_checks();
   }
 
+  if (m_state_hash and this->type()!=AtmosphereProcessType::Group) {
+    // Only computed fields can have changed during this run
+    update_incremental_state_hash();
+  }
+
   m_time_stamp += dt;
   if (m_update_time_stamps) {
     // Update all output fields time stamps
@@ -13,6 +13,7 @@
 #include "share/field/field.hpp"
 #include "share/field/field_group.hpp"
 #include "share/grid/grids_manager.hpp"
+#include "share/util/scream_bfbhash.hpp"
 
 #include "ekat/mpi/ekat_comm.hpp"
 #include "ekat/ekat_parameter_list.hpp"
@@ -279,6 +280,9 @@ public:
                                const bool out = true, const bool internal = true) const;
   // For BFB tracking in production simulations.
   void print_fast_global_state_hash(const std::string& label) const;
+  // Rehash this process's computed fields (and, if requested, its input and
+  // internal fields too) into the shared incremental state hash, if any.
+  void update_incremental_state_hash(const bool all_fields = false) const;
 
   // Set IOP object
   virtual void set_iop(const iop_ptr& iop) {
@@ -476,6 +480,10 @@ protected:
   //       logger, we might as well expose the member to all derived classes.
   std::shared_ptr<logger_t>  m_atm_logger;
 
+  // Running hash of the atm state, shared by all processes. If not null, each
+  // process updates it with the hashes of its computed fields after running.
+  std::shared_ptr<bfbhash::IncrementalStateHash> m_state_hash;
+
   // Extra data needed for restart
   strmap_t<any_ptr_t>  m_restart_extra_data;
 
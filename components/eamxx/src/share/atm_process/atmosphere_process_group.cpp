@@ -75,6 +75,11 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
     // Set logger in this ap params
     params_i.set("Logger",this->m_atm_logger);
 
+    // Share the incremental state hash (if any) with this ap
+    if (this->m_state_hash) {
+      params_i.set("IncrementalStateHash",this->m_state_hash);
+    }
+
     // Create the atm proc
     auto ap = apf.create(ap_type,proc_comm,params_i);
     m_atm_processes.push_back(ap);
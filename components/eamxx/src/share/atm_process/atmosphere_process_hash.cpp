@@ -111,6 +111,25 @@ void hash (const std::list<FieldGroup>& fgs, HashType& accum) {
       hash(*e.second, accum);
 }
 
+void update (bfbhash::IncrementalStateHash& sh, const Field& f) {
+  const auto& id = f.get_header().get_identifier();
+  if (id.data_type() != DataType::DoubleType) return;
+  HashType accum = 0;
+  hash(f, accum);
+  sh.update(id.get_id_string(), accum);
+}
+
+void update (bfbhash::IncrementalStateHash& sh, const std::list<Field>& fs) {
+  for (const auto& f : fs)
+    update(sh, f);
+}
+
+void update (bfbhash::IncrementalStateHash& sh, const std::list<FieldGroup>& fgs) {
+  for (const auto& g : fgs)
+    for (const auto& e : g.m_fields)
+      update(sh, *e.second);
+}
+
 } // namespace anon
 
 void AtmosphereProcess
@@ -144,4 +163,16 @@ void AtmosphereProcess::print_fast_global_state_hash (const std::string& label)
             timestamp().get_num_steps(), gaccum, label.c_str());
 }
 
+void AtmosphereProcess::update_incremental_state_hash (const bool all_fields) const {
+  if (not m_state_hash) return;
+  auto& sh = *m_state_hash;
+  update(sh, m_fields_out);
+  update(sh, m_groups_out);
+  if (all_fields) {
+    update(sh, m_fields_in);
+    update(sh, m_groups_in);
+    update(sh, m_internal_fields);
+  }
+}
+
 } // namespace scream
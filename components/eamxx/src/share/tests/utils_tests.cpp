@@ -5,6 +5,7 @@
 #include "share/util/scream_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_bfbhash.hpp"
 #include "share/scream_config.hpp"
 
 TEST_CASE("contiguous_superset") {
@@ -250,3 +251,37 @@ TEST_CASE ("array_utils") {
     }
   }
 }
+
+TEST_CASE ("incremental_state_hash") {
+  using namespace scream;
+  using bfbhash::HashType;
+
+  // Updating an entry in place must give the same state as building the
+  // state from scratch with the final entry values, regardless of order.
+  bfbhash::IncrementalStateHash sh1, sh2;
+  sh1.update("A",1);
+  sh1.update("B",2);
+  sh1.update("C",3);
+  sh1.update("B",42);
+  REQUIRE (sh1.num_entries()==3);
+  REQUIRE (sh1.has_entry("B"));
+  REQUIRE (not sh1.has_entry("D"));
+
+  sh2.update("C",3);
+  sh2.update("B",42);
+  sh2.update("A",1);
+  REQUIRE (sh1.local_state()==sh2.local_state());
+
+  // Swapping values across entries changes the state
+  bfbhash::IncrementalStateHash sh3;
+  sh3.update("A",42);
+  sh3.update("B",1);
+  sh3.update("C",3);
+  REQUIRE (sh3.local_state()!=sh1.local_state());
+
+  // Resetting all entries to 0 gives back the empty state
+  for (const std::string k : {"A","B","C"}) {
+    sh1.update(k,0);
+  }
+  REQUIRE (sh1.local_state()==HashType(0));
+}
@@ -21,5 +21,28 @@ int all_reduce_HashType (MPI_Comm comm, const HashType* sendbuf, HashType* rcvbu
   return stat;
 }
 
+void IncrementalStateHash::update (const std::string& key, const HashType h) {
+  auto it = m_entries.find(key);
+  if (it==m_entries.end()) {
+    // FNV-1a of the key, forced odd so that the weight is invertible mod 2^64.
+    HashType w = 14695981039346656037ULL;
+    for (const char c : key) {
+      w ^= static_cast<unsigned char>(c);
+      w *= 1099511628211ULL;
+    }
+    it = m_entries.emplace(key,Entry{w | 1, 0}).first;
+  }
+  auto& e = it->second;
+  m_state -= e.weight*e.hash;
+  m_state += e.weight*h;
+  e.hash = h;
+}
+
+HashType IncrementalStateHash::global_state (MPI_Comm comm) const {
+  HashType gstate;
+  all_reduce_HashType(comm, &m_state, &gstate, 1);
+  return gstate;
+}
+
 } // namespace bfbhash
 } // namespace scream
@@ -2,6 +2,8 @@
 #define SCREAM_BFBHASH_HPP
 
 #include <cstdint>
+#include <map>
+#include <string>
 
 #include <ekat/kokkos/ekat_kokkos_types.hpp>
 #include <ekat/mpi/ekat_comm.hpp>
@@ -50,6 +52,35 @@ private:
 int all_reduce_HashType(MPI_Comm comm, const HashType* sendbuf, HashType* rcvbuf,
                         int count);
 
+// Running hash over a set of keyed entries (e.g., fields), for BFB tracking in
+// production runs. hash() above is addition mod 2^64, so an entry's
+// contribution can be removed by subtraction: replacing one entry's hash is
+// O(1), and the rank-local states still combine with all_reduce_HashType into
+// a PE-layout-independent global value. Each entry is weighted by an odd
+// multiplier derived from its key, so that two entries with swapped values do
+// not produce the same state.
+class IncrementalStateHash {
+public:
+  // Replace the contribution of entry 'key' with 'h'.
+  void update (const std::string& key, const HashType h);
+
+  bool has_entry (const std::string& key) const { return m_entries.count(key)==1; }
+  int num_entries () const { return m_entries.size(); }
+
+  HashType local_state () const { return m_state; }
+  // Collective over comm.
+  HashType global_state (MPI_Comm comm) const;
+
+private:
+  struct Entry {
+    HashType weight;
+    HashType hash;
+  };
+
+  std::map<std::string,Entry> m_entries;
+  HashType m_state = 0;
+};
+
 } // namespace bfbhash
 } // namespace scream
 
@@ -5,6 +5,22 @@ function (prc var)
   message("${var} ${${var}}")
 endfunction ()
 
+# HostIsaCheck.cpp checks at load time that the host supports the AVX sets the
+# rest of HOMMEXX was compiled for, so it must itself be compiled without AVX.
+# Source properties are per directory, so call this wherever a target lists
+# the file.
+function (homme_host_isa_check_flags)
+  set (src ${HOMME_SOURCE_DIR}/src/share/cxx/HostIsaCheck.cpp)
+  if (CUDA_BUILD OR HIP_BUILD)
+    return ()
+  endif ()
+  if (CMAKE_CXX_COMPILER_ID STREQUAL "Intel")
+    set_source_files_properties (${src} PROPERTIES COMPILE_OPTIONS "-xSSE2")
+  elseif (CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang|IntelLLVM")
+    set_source_files_properties (${src} PROPERTIES COMPILE_OPTIONS "-mno-avx512f;-mno-avx2;-mno-avx")
+  endif ()
+endfunction ()
+
 # Macro to create config file. The macro creates a temporary config
 # file first. If the config file in the build directory does not
 # exist or it is different from the temporary one, then the config
@@ -112,6 +128,7 @@ macro(createTestExec execName execType macroNP macroNC
   ADD_DEFINITIONS(-DHAVE_CONFIG_H)
 
   ADD_EXECUTABLE(${execName} ${EXEC_SOURCES})
+  homme_host_isa_check_flags()
   SET_TARGET_PROPERTIES(${execName} PROPERTIES LINKER_LANGUAGE Fortran)
   IF(BUILD_HOMME_WITHOUT_PIOLIBRARY)
     TARGET_COMPILE_DEFINITIONS(${execName} PUBLIC HOMME_WITHOUT_PIOLIBRARY)
@@ -233,6 +250,7 @@ macro(createExecLib libName execType libSrcs inclDirs macroNP
   ADD_DEFINITIONS(-DHAVE_CONFIG_H)
 
   ADD_LIBRARY(${libName} ${libSrcs})
+  homme_host_isa_check_flags()
   TARGET_INCLUDE_DIRECTORIES (${libName} PUBLIC ${inclDirs} ${modulesDir} ${CMAKE_CURRENT_BINARY_DIR})
   SET_TARGET_PROPERTIES(${libName} PROPERTIES Fortran_MODULE_DIRECTORY ${modulesDir})
   SET_TARGET_PROPERTIES(${libName} PROPERTIES LINKER_LANGUAGE Fortran)
@@ -77,6 +77,23 @@ int waitall (int count, Request* reqs, MPI_Status* stats) {
 #endif
 }
 
+int testall (int count, Request* reqs, int* flag, MPI_Status* stats) {
+#ifdef COMPOSE_DEBUG_MPI
+  std::vector<MPI_Request> vreqs(count);
+  for (int i = 0; i < count; ++i) vreqs[i] = reqs[i].request;
+  const auto out = MPI_Testall(count, vreqs.data(), flag,
+                               stats ? stats : MPI_STATUSES_IGNORE);
+  for (int i = 0; i < count; ++i) {
+    reqs[i].request = vreqs[i];
+    if (*flag) reqs[i].unfreed--;
+  }
+  return out;
+#else
+  return MPI_Testall(count, reinterpret_cast<MPI_Request*>(reqs), flag,
+                     stats ? stats : MPI_STATUSES_IGNORE);
+#endif
+}
+
 bool all_ok (const Parallel& p, bool im_ok) {
   int ok = im_ok, msg;
   all_reduce<int>(p, &ok, &msg, 1, MPI_LAND);
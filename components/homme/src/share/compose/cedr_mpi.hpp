@@ -59,6 +59,8 @@ int waitany(int count, Request* reqs, int* index, MPI_Status* stats = nullptr);
 
 int waitall(int count, Request* reqs, MPI_Status* stats = nullptr);
 
+int testall(int count, Request* reqs, int* flag, MPI_Status* stats = nullptr);
+
 template<typename T>
 int gather(const Parallel& p, const T* sendbuf, int sendcount,
            T* recvbuf, int recvcount, int root);
@@ -102,7 +102,7 @@ int QLT<ES>::MetaData::get_problem_type_r2l_bulk_size (const int& mask) {
 }
 
 template <typename ES>
-void QLT<ES>::MetaData::init (const MetaDataBuilder& mdb) {
+void QLT<ES>::MetaData::init (const MetaDataBuilder& mdb, const Int nslots) {
   const Int ntracers = mdb.trcr2prob.size();
 
   Me::init("trcr2prob", a_d_.trcr2prob, a_h_.trcr2prob, ntracers);
@@ -122,9 +122,6 @@ void QLT<ES>::MetaData::init (const MetaDataBuilder& mdb) {
     for (Int ti = 0; ti < ntracers; ++ti) {
       const auto problem_type = a_h_.trcr2prob[ti];
       if (problem_type != get_problem_type(pi)) continue;
-      const auto tcnt = a_h_.prob2trcrptr[pi+1] - a_h_.prob2trcrptr[pi];
-      a_h_.trcr2bl2r[ti] = a_h_.prob2bl2r[pi] + tcnt*l2rbulksz;
-      a_h_.trcr2br2l[ti] = a_h_.prob2br2l[pi] + tcnt*r2lbulksz;
       a_h_.bidx2trcr[a_h_.prob2trcrptr[pi+1]++] = ti;
     }
     Int ni = a_h_.prob2trcrptr[pi+1] - a_h_.prob2trcrptr[pi];
@@ -132,14 +129,46 @@ void QLT<ES>::MetaData::init (const MetaDataBuilder& mdb) {
     a_h_.prob2br2l[pi+1] = a_h_.prob2br2l[pi] + ni*r2lbulksz;
   }
   Kokkos::deep_copy(a_d_.bidx2trcr, a_h_.bidx2trcr);
-  Kokkos::deep_copy(a_d_.trcr2bl2r, a_h_.trcr2bl2r);
-  Kokkos::deep_copy(a_d_.trcr2br2l, a_h_.trcr2br2l);
 
   Me::init("trcr2bidx", a_d_.trcr2bidx, a_h_.trcr2bidx, ntracers);
   for (Int ti = 0; ti < ntracers; ++ti)
     a_h_.trcr2bidx(a_h_.bidx2trcr(ti)) = ti;
   Kokkos::deep_copy(a_d_.trcr2bidx, a_h_.trcr2bidx);
 
+  // Split the bulk indices into contiguous groups and lay out each group's
+  // slot. Within a group, tracers remain ordered by problem type.
+  const Int ngrp = std::max(1, std::min(mdb.ntracer_groups, ntracers));
+  a_h_.nslots = nslots;
+  Me::init("trcr2grp", a_d_.trcr2grp, a_h_.trcr2grp, ntracers);
+  Me::init("grp2bidx", a_d_.grp2bidx, a_h_.grp2bidx, ngrp+1);
+  Me::init("grp2bl2r", a_d_.grp2bl2r, a_h_.grp2bl2r, ngrp+1);
+  Me::init("grp2br2l", a_d_.grp2br2l, a_h_.grp2br2l, ngrp+1);
+  a_h_.grp2bl2r(0) = a_h_.grp2br2l(0) = 0;
+  for (Int g = 0; g <= ngrp; ++g)
+    a_h_.grp2bidx(g) = (g*ntracers)/ngrp;
+  for (Int g = 0; g < ngrp; ++g) {
+    Int l2ros = 1, r2los = 0; // rho is at 0.
+    for (Int bi = a_h_.grp2bidx(g); bi < a_h_.grp2bidx(g+1); ++bi) {
+      const Int ti = a_h_.bidx2trcr(bi);
+      const auto problem_type = a_h_.trcr2prob(ti);
+      a_h_.trcr2grp(ti) = g;
+      a_h_.trcr2bl2r(ti) = l2ros;
+      a_h_.trcr2br2l(ti) = r2los;
+      l2ros += get_problem_type_l2r_bulk_size(problem_type);
+      r2los += get_problem_type_r2l_bulk_size(problem_type);
+    }
+    a_h_.grp2bl2r(g+1) = a_h_.grp2bl2r(g) + l2ros;
+    a_h_.grp2br2l(g+1) = a_h_.grp2br2l(g) + r2los;
+  }
+  cedr_assert(ngrp > 1 || a_h_.grp2bl2r(1) == a_h_.prob2bl2r[nprobtypes]);
+  cedr_assert(ngrp > 1 || a_h_.grp2br2l(1) == a_h_.prob2br2l[nprobtypes]);
+  Kokkos::deep_copy(a_d_.trcr2bl2r, a_h_.trcr2bl2r);
+  Kokkos::deep_copy(a_d_.trcr2br2l, a_h_.trcr2br2l);
+  Kokkos::deep_copy(a_d_.trcr2grp, a_h_.trcr2grp);
+  Kokkos::deep_copy(a_d_.grp2bidx, a_h_.grp2bidx);
+  Kokkos::deep_copy(a_d_.grp2bl2r, a_h_.grp2bl2r);
+  Kokkos::deep_copy(a_d_.grp2br2l, a_h_.grp2br2l);
+
   a_h = a_h_;
 
   // Won't default construct Unmanaged, so have to do pointer stuff and raw
@@ -149,6 +178,11 @@ void QLT<ES>::MetaData::init (const MetaDataBuilder& mdb) {
   a_d.trcr2bidx = a_d_.trcr2bidx;
   a_d.trcr2bl2r = a_d_.trcr2bl2r;
   a_d.trcr2br2l = a_d_.trcr2br2l;
+  a_d.nslots = a_h_.nslots;
+  a_d.trcr2grp = a_d_.trcr2grp;
+  a_d.grp2bidx = a_d_.grp2bidx;
+  a_d.grp2bl2r = a_d_.grp2bl2r;
+  a_d.grp2br2l = a_d_.grp2br2l;
   std::copy(a_h_.prob2trcrptr, a_h_.prob2trcrptr + nprobtypes + 1,
             a_d.prob2trcrptr);
   std::copy(a_h_.prob2bl2r, a_h_.prob2bl2r + nprobtypes + 1, a_d.prob2bl2r);
@@ -284,17 +318,42 @@ void QLT<ES>::declare_tracer (int problem_type, const Int& rhomidx) {
   mdb_->trcr2prob.push_back(problem_type);
 }
 
+template <typename ES>
+void QLT<ES>::set_num_tracer_groups (const Int ngroups) {
+  cedr_throw_if( ! mdb_, "end_tracer_declarations was already called; "
+                 "it is an error to call set_num_tracer_groups now.");
+  cedr_throw_if(ngroups < 1 || ngroups > tree::NodeSets::max_ngrp,
+                "ngroups must be in [1, " << int(tree::NodeSets::max_ngrp) << "].");
+  mdb_->ntracer_groups = ngroups;
+}
+
+template <typename ES>
+Int QLT<ES>::get_num_tracer_groups () const {
+  if (mdb_) return mdb_->ntracer_groups;
+  return o.md_.a_h.grp2bidx.extent_int(0) - 1;
+}
+
+// With one group, use the tag shared with the other CEDR tree reductions, as
+// before grouping existed; otherwise, the group's tag in the reserved range.
+template <typename ES>
+int QLT<ES>::get_mpitag (const Int& grp) const {
+  if (get_num_tracer_groups() == 1) return tree::NodeSets::mpitag;
+  return tree::NodeSets::mpitag_grp + grp;
+}
+
 template <typename ES>
 void QLT<ES>::end_tracer_declarations () {
-  o.md_.init(*mdb_);
+  o.md_.init(*mdb_, ns_->nslots);
   mdb_ = nullptr;
 }
 
 template <typename ES>
 void QLT<ES>::get_buffers_sizes (size_t& buf1, size_t& buf2) {
   const auto nslots = ns_->nslots;
-  buf1 = o.md_.a_h.prob2bl2r[o.md_.nprobtypes]*nslots;
-  buf2 = o.md_.a_h.prob2br2l[o.md_.nprobtypes]*nslots;
+  const auto& a = o.md_.a_h;
+  const Int ngrp = a.grp2bidx.extent_int(0) - 1;
+  buf1 = a.grp2bl2r(ngrp)*nslots;
+  buf2 = a.grp2br2l(ngrp)*nslots;
 }
 
 template <typename ES>
@@ -324,26 +383,47 @@ Int QLT<ES>::get_num_tracers () const {
   return o.md_.a_h.trcr2prob.size();
 }
 
+// Offset to the start of tracer group grp's bulk data, and number of data per
+// slot in the group.
+template <typename Arrays>
+void get_grp_layout (const Arrays& a, const Int& grp, const bool l2r,
+                     Int& os, Int& ndps) {
+  const auto& grp2b = l2r ? a.grp2bl2r : a.grp2br2l;
+  os = a.nslots*grp2b(grp);
+  ndps = grp2b(grp+1) - grp2b(grp);
+}
+
 template <typename ES> void QLT<ES>
-::l2r_recv (const tree::NodeSets::Level& lvl, const Int& l2rndps) const {
+::l2r_irecv (const tree::NodeSets::Level& lvl, const Int& grp) const {
+  Int os, l2rndps;
+  get_grp_layout(o.md_.a_h, grp, true, os, l2rndps);
   for (size_t i = 0; i < lvl.kids.size(); ++i) {
     const auto& mmd = lvl.kids[i];
-    mpi::irecv(*p_, o.bd_.l2r_data.data() + mmd.offset*l2rndps, mmd.size*l2rndps,
-               mmd.rank, tree::NodeSets::mpitag, &lvl.kids_req[i]);
+    mpi::irecv(*p_, o.bd_.l2r_data.data() + os + mmd.offset*l2rndps,
+               mmd.size*l2rndps, mmd.rank, get_mpitag(grp),
+               &lvl.kids_req[i]);
   }
+}
+
+template <typename ES> void QLT<ES>
+::l2r_recv (const tree::NodeSets::Level& lvl, const Int& grp) const {
+  l2r_irecv(lvl, grp);
   Timer::start(Timer::waitall);
   mpi::waitall(lvl.kids_req.size(), lvl.kids_req.data());
   Timer::stop(Timer::waitall);
 }
 
 template <typename ES> void QLT<ES>
-::l2r_combine_kid_data (const Int& lvlidx, const Int& l2rndps) const {
+::l2r_combine_kid_data (const Int& lvlidx, const Int& grp) const {
+  Int os, l2rndps;
+  get_grp_layout(o.md_.a_h, grp, true, os, l2rndps);
+  const auto l2r_data = Kokkos::subview(
+    o.bd_.l2r_data, std::make_pair(os, os + o.md_.a_h.nslots*l2rndps));
+  const Int gbs = o.md_.a_h.grp2bidx(grp), gbe = o.md_.a_h.grp2bidx(grp+1);
   if (cedr::impl::OnGpu<ES>::value) {
     const auto d = *nsdd_;
-    const auto l2r_data = o.bd_.l2r_data;
     const auto a = o.md_.a_d;
-    const Int ntracer = a.trcr2prob.size();
-    const Int nfield = ntracer + 1;
+    const Int nfield = gbe - gbs + 1;
     const Int lvl_os = nshd_->lvlptr(lvlidx);
     const Int N = nfield*(nshd_->lvlptr(lvlidx+1) - lvl_os);
     const auto combine_kid_data = KOKKOS_LAMBDA (const Int& k) {
@@ -360,7 +440,7 @@ template <typename ES> void QLT<ES>
            l2r_data(d.node(n.kids[1]).offset*l2rndps));
       } else {
         // Tracers. Order by bulk index for efficiency of memory access.
-        const Int bi = fi - 1; // bulk index
+        const Int bi = gbs + fi - 1; // bulk index
         const Int ti = a.bidx2trcr(bi); // tracer (user) index
         const Int problem_type = a.trcr2prob(ti);
         const bool nonnegative = problem_type & ProblemType::nonnegative;
@@ -397,23 +477,24 @@ template <typename ES> void QLT<ES>
       if ( ! n->nkids) continue;
       cedr_assert(n->nkids == 2);
       // Total density.
-      o.bd_.l2r_data(n->offset*l2rndps) =
-        (o.bd_.l2r_data(ns_->node_h(n->kids[0])->offset*l2rndps) +
-         o.bd_.l2r_data(ns_->node_h(n->kids[1])->offset*l2rndps));
+      l2r_data(n->offset*l2rndps) =
+        (l2r_data(ns_->node_h(n->kids[0])->offset*l2rndps) +
+         l2r_data(ns_->node_h(n->kids[1])->offset*l2rndps));
       // Tracers.
       for (Int pti = 0; pti < o.md_.nprobtypes; ++pti) {
         const Int problem_type = o.md_.get_problem_type(pti);
         const bool nonnegative = problem_type & ProblemType::nonnegative;
         const bool shapepreserve = problem_type & ProblemType::shapepreserve;
         const bool conserve = problem_type & ProblemType::conserve;
-        const Int bis = o.md_.a_d.prob2trcrptr[pti], bie = o.md_.a_d.prob2trcrptr[pti+1];
+        const Int bis = std::max(o.md_.a_d.prob2trcrptr[pti], gbs);
+        const Int bie = std::min(o.md_.a_d.prob2trcrptr[pti+1], gbe);
         for (Int bi = bis; bi < bie; ++bi) {
           const Int bdi = o.md_.a_d.trcr2bl2r(o.md_.a_d.bidx2trcr(bi));
-          Real* const me = &o.bd_.l2r_data(n->offset*l2rndps + bdi);
+          Real* const me = &l2r_data(n->offset*l2rndps + bdi);
           const auto kid0 = ns_->node_h(n->kids[0]);
           const auto kid1 = ns_->node_h(n->kids[1]);
-          const Real* const k0 = &o.bd_.l2r_data(kid0->offset*l2rndps + bdi);
-          const Real* const k1 = &o.bd_.l2r_data(kid1->offset*l2rndps + bdi);
+          const Real* const k0 = &l2r_data(kid0->offset*l2rndps + bdi);
+          const Real* const k1 = &l2r_data(kid1->offset*l2rndps + bdi);
           if (nonnegative) {
             me[0] = k0[0] + k1[0];
             if (conserve) me[1] = k0[1] + k1[1];
@@ -430,26 +511,33 @@ template <typename ES> void QLT<ES>
 }
 
 template <typename ES> void QLT<ES>
-::l2r_send_to_parents (const tree::NodeSets::Level& lvl, const Int& l2rndps) const {
+::l2r_send_to_parents (const tree::NodeSets::Level& lvl, const Int& grp) const {
+  Int os, l2rndps;
+  get_grp_layout(o.md_.a_h, grp, true, os, l2rndps);
   for (size_t i = 0; i < lvl.me.size(); ++i) {
     const auto& mmd = lvl.me[i];
-    mpi::isend(*p_, o.bd_.l2r_data.data() + mmd.offset*l2rndps, mmd.size*l2rndps,
-               mmd.rank, tree::NodeSets::mpitag);
+    mpi::isend(*p_, o.bd_.l2r_data.data() + os + mmd.offset*l2rndps,
+               mmd.size*l2rndps, mmd.rank, get_mpitag(grp));
   }  
 }
 
 template <typename ES> void QLT<ES>
-::root_compute (const Int& l2rndps, const Int& r2lndps) const {
+::root_compute (const Int& grp) const {
   if (ns_->levels.empty() || ns_->levels.back().nodes.size() != 1 ||
       ns_->node_h(ns_->levels.back().nodes[0])->parent >= 0)
     return;
+  const auto& ah = o.md_.a_h;
+  Int l2ros, l2rndps, r2los, r2lndps;
+  get_grp_layout(ah, grp, true, l2ros, l2rndps);
+  get_grp_layout(ah, grp, false, r2los, r2lndps);
   const auto d = *nsdd_;
-  const auto l2r_data = o.bd_.l2r_data;
-  const auto r2l_data = o.bd_.r2l_data;
+  const auto l2r_data = Kokkos::subview(
+    o.bd_.l2r_data, std::make_pair(l2ros, l2ros + ah.nslots*l2rndps));
+  const auto r2l_data = Kokkos::subview(
+    o.bd_.r2l_data, std::make_pair(r2los, r2los + ah.nslots*r2lndps));
   const auto a = o.md_.a_d;
   const Int nlev = nshd_->lvlptr.size() - 1;
   const Int node_idx = nshd_->lvl(nshd_->lvlptr(nlev-1));
-  const Int ntracer = a.trcr2prob.size();
   const auto compute = KOKKOS_LAMBDA (const Int& bi) {
     const auto& n = d.node(node_idx);
     const Int ti = a.bidx2trcr(bi);
@@ -471,17 +559,26 @@ template <typename ES> void QLT<ES>
       r2l_data(n.offset*r2lndps + r2lbdi + 2) = l2r_data(n.offset*l2rndps + l2rbdi + 2);
     }
   };
-  Kokkos::parallel_for(Kokkos::RangePolicy<ES>(0, ntracer), compute);
+  Kokkos::parallel_for(Kokkos::RangePolicy<ES>(ah.grp2bidx(grp), ah.grp2bidx(grp+1)),
+                       compute);
   Kokkos::fence();
 }
 
 template <typename ES> void QLT<ES>
-::r2l_recv (const tree::NodeSets::Level& lvl, const Int& r2lndps) const {
+::r2l_irecv (const tree::NodeSets::Level& lvl, const Int& grp) const {
+  Int os, r2lndps;
+  get_grp_layout(o.md_.a_h, grp, false, os, r2lndps);
   for (size_t i = 0; i < lvl.me.size(); ++i) {
     const auto& mmd = lvl.me[i];
-    mpi::irecv(*p_, o.bd_.r2l_data.data() + mmd.offset*r2lndps, mmd.size*r2lndps,
-               mmd.rank, tree::NodeSets::mpitag, &lvl.me_recv_req[i]);
+    mpi::irecv(*p_, o.bd_.r2l_data.data() + os + mmd.offset*r2lndps,
+               mmd.size*r2lndps, mmd.rank, get_mpitag(grp),
+               &lvl.me_recv_req[i]);
   }
+}
+
+template <typename ES> void QLT<ES>
+::r2l_recv (const tree::NodeSets::Level& lvl, const Int& grp) const {
+  r2l_irecv(lvl, grp);
   Timer::start(Timer::waitall);
   mpi::waitall(lvl.me_recv_req.size(), lvl.me_recv_req.data());
   Timer::stop(Timer::waitall);
@@ -523,21 +620,28 @@ void r2l_solve_qp_solve_node_problem (
 }
 
 template <typename ES> void QLT<ES>
-::r2l_solve_qp (const Int& lvlidx, const Int& l2rndps, const Int& r2lndps) const {
+::r2l_solve_qp (const Int& lvlidx, const Int& grp) const {
   Timer::start(Timer::snp);
   const bool prefer_mass_con_to_bounds =
     options_.prefer_numerical_mass_conservation_to_numerical_bounds;
+  const auto& ah = o.md_.a_h;
+  Int l2ros, l2rndps, r2los, r2lndps;
+  get_grp_layout(ah, grp, true, l2ros, l2rndps);
+  get_grp_layout(ah, grp, false, r2los, r2lndps);
+  const auto l2r_data = Kokkos::subview(
+    o.bd_.l2r_data, std::make_pair(l2ros, l2ros + ah.nslots*l2rndps));
+  const auto r2l_data = Kokkos::subview(
+    o.bd_.r2l_data, std::make_pair(r2los, r2los + ah.nslots*r2lndps));
+  const Int gbs = ah.grp2bidx(grp), gbe = ah.grp2bidx(grp+1);
   if (cedr::impl::OnGpu<ES>::value) {
     const auto d = *nsdd_;
-    const auto l2r_data = o.bd_.l2r_data;
-    const auto r2l_data = o.bd_.r2l_data;
     const auto a = o.md_.a_d;
-    const Int ntracer = a.trcr2prob.size();
+    const Int ntracer = gbe - gbs;
     const Int lvl_os = nshd_->lvlptr(lvlidx);
     const Int N = ntracer*(nshd_->lvlptr(lvlidx+1) - lvl_os);
     const auto solve_qp = KOKKOS_LAMBDA (const Int& k) {
       const Int il = lvl_os + k / ntracer;
-      const Int bi = k % ntracer;
+      const Int bi = gbs + k % ntracer;
       const auto node_idx = d.lvl(il);
       const auto& n = d.node(node_idx);
       if ( ! n.nkids) return;
@@ -576,24 +680,25 @@ template <typename ES> void QLT<ES>
       if ( ! n->nkids) continue;
       for (Int pti = 0; pti < o.md_.nprobtypes; ++pti) {
         const Int problem_type = o.md_.get_problem_type(pti);
-        const Int bis = o.md_.a_d.prob2trcrptr[pti], bie = o.md_.a_d.prob2trcrptr[pti+1];
+        const Int bis = std::max(o.md_.a_d.prob2trcrptr[pti], gbs);
+        const Int bie = std::min(o.md_.a_d.prob2trcrptr[pti+1], gbe);
         for (Int bi = bis; bi < bie; ++bi) {
           const Int l2rbdi = o.md_.a_d.trcr2bl2r(o.md_.a_d.bidx2trcr(bi));
           const Int r2lbdi = o.md_.a_d.trcr2br2l(o.md_.a_d.bidx2trcr(bi));
           cedr_assert(n->nkids == 2);
           if ((problem_type & ProblemType::consistent) &&
               ! (problem_type & ProblemType::shapepreserve)) {
-            const Real q_min = o.bd_.r2l_data(n->offset*r2lndps + r2lbdi + 1);
-            const Real q_max = o.bd_.r2l_data(n->offset*r2lndps + r2lbdi + 2);
-            o.bd_.l2r_data(n->offset*l2rndps + l2rbdi + 0) = q_min;
-            o.bd_.l2r_data(n->offset*l2rndps + l2rbdi + 2) = q_max;
+            const Real q_min = r2l_data(n->offset*r2lndps + r2lbdi + 1);
+            const Real q_max = r2l_data(n->offset*r2lndps + r2lbdi + 2);
+            l2r_data(n->offset*l2rndps + l2rbdi + 0) = q_min;
+            l2r_data(n->offset*l2rndps + l2rbdi + 2) = q_max;
             for (Int k = 0; k < 2; ++k)
-              r2l_solve_qp_set_q(o.bd_.l2r_data, o.bd_.r2l_data,
+              r2l_solve_qp_set_q(l2r_data, r2l_data,
                                  ns_->node_h(n->kids[k])->offset,
                                  l2rndps, r2lndps, l2rbdi, r2lbdi, q_min, q_max);
           }
           r2l_solve_qp_solve_node_problem(
-            o.bd_.l2r_data, o.bd_.r2l_data, problem_type, *n, *ns_->node_h(n->kids[0]),
+            l2r_data, r2l_data, problem_type, *n, *ns_->node_h(n->kids[0]),
             *ns_->node_h(n->kids[1]), l2rndps, r2lndps, l2rbdi, r2lbdi,
             prefer_mass_con_to_bounds);
         }
@@ -604,11 +709,13 @@ template <typename ES> void QLT<ES>
 }
 
 template <typename ES> void QLT<ES>
-::r2l_send_to_kids (const tree::NodeSets::Level& lvl, const Int& r2lndps) const {
+::r2l_send_to_kids (const tree::NodeSets::Level& lvl, const Int& grp) const {
+  Int os, r2lndps;
+  get_grp_layout(o.md_.a_h, grp, false, os, r2lndps);
   for (size_t i = 0; i < lvl.kids.size(); ++i) {
     const auto& mmd = lvl.kids[i];
-    mpi::isend(*p_, o.bd_.r2l_data.data() + mmd.offset*r2lndps, mmd.size*r2lndps,
-               mmd.rank, tree::NodeSets::mpitag);
+    mpi::isend(*p_, o.bd_.r2l_data.data() + os + mmd.offset*r2lndps,
+               mmd.size*r2lndps, mmd.rank, get_mpitag(grp));
   }
 }
 
@@ -618,27 +725,97 @@ const typename QLT<ES>::DeviceOp& QLT<ES>::get_device_op() { return o; }
 template <typename ES>
 void QLT<ES>::run () {
   cedr_assert(o.bd_.inited());
+  if (get_num_tracer_groups() > 1) {
+    run_pipelined();
+    return;
+  }
   Timer::start(Timer::qltrunl2r);
-  // Number of data per slot.
-  const Int l2rndps = o.md_.a_h.prob2bl2r[o.md_.nprobtypes];
-  const Int r2lndps = o.md_.a_h.prob2br2l[o.md_.nprobtypes];
   for (size_t il = 0; il < ns_->levels.size(); ++il) {
     auto& lvl = ns_->levels[il];
-    if (lvl.kids.size()) l2r_recv(lvl, l2rndps);
-    l2r_combine_kid_data(il, l2rndps);    
-    if (lvl.me.size()) l2r_send_to_parents(lvl, l2rndps);
+    if (lvl.kids.size()) l2r_recv(lvl, 0);
+    l2r_combine_kid_data(il, 0);
+    if (lvl.me.size()) l2r_send_to_parents(lvl, 0);
   }
   Timer::stop(Timer::qltrunl2r); Timer::start(Timer::qltrunr2l);
-  root_compute(l2rndps, r2lndps);
+  root_compute(0);
   for (size_t il = ns_->levels.size(); il > 0; --il) {
     auto& lvl = ns_->levels[il-1];
-    if (lvl.me.size()) r2l_recv(lvl, r2lndps);
-    r2l_solve_qp(il-1, l2rndps, r2lndps);
-    if (lvl.kids.size()) r2l_send_to_kids(lvl, r2lndps);
+    if (lvl.me.size()) r2l_recv(lvl, 0);
+    r2l_solve_qp(il-1, 0);
+    if (lvl.kids.size()) r2l_send_to_kids(lvl, 0);
   }
   Timer::stop(Timer::qltrunr2l);
 }
 
+// The l2r sweep runs over the tracer groups in order. The r2l sweep of group g
+// starts once the l2r sweep of group g is done on this rank. Each sweep
+// advances one level at a time as its messages arrive, so while one waits on
+// communication, the other computes and sends. A sweep blocks in waitall only
+// if the other sweep has nothing to do. Thus neither sweep ever waits on the
+// other, and deadlock freedom follows from that of the level schedule.
+template <typename ES>
+void QLT<ES>::run_pipelined () const {
+  const Int ngrp = get_num_tracer_groups();
+  const Int nlvl = ns_->levels.size();
+  // Level 0 holds this rank's cells, which the constructor requires to exist.
+  cedr_assert(nlvl > 0);
+  const auto ready = [&] (std::vector<mpi::Request>& reqs, const bool block) {
+    if (reqs.empty()) return true;
+    if (block) {
+      Timer::start(Timer::waitall);
+      mpi::waitall(reqs.size(), reqs.data());
+      Timer::stop(Timer::waitall);
+      return true;
+    }
+    int flag = 0;
+    mpi::testall(reqs.size(), reqs.data(), &flag);
+    return flag != 0;
+  };
+  // Current group and level of each sweep. r2l_lvl == nlvl means the root
+  // computation is next. A level's receives are posted once, then tested until
+  // they complete.
+  Int l2r_grp = 0, l2r_lvl = 0, r2l_grp = 0, r2l_lvl = nlvl;
+  bool l2r_posted = false, r2l_posted = false;
+  while (r2l_grp < ngrp) {
+    if (l2r_grp < ngrp) {
+      const auto& lvl = ns_->levels[l2r_lvl];
+      if ( ! l2r_posted) {
+        if (lvl.kids.size()) l2r_irecv(lvl, l2r_grp);
+        l2r_posted = true;
+      }
+      if ( ! lvl.kids.size() || ready(lvl.kids_req, r2l_grp == l2r_grp)) {
+        l2r_combine_kid_data(l2r_lvl, l2r_grp);
+        if (lvl.me.size()) l2r_send_to_parents(lvl, l2r_grp);
+        l2r_posted = false;
+        if (++l2r_lvl == nlvl) {
+          l2r_lvl = 0;
+          ++l2r_grp;
+        }
+      }
+    }
+    if (r2l_grp < l2r_grp) {
+      if (r2l_lvl == nlvl) {
+        root_compute(r2l_grp);
+        --r2l_lvl;
+      }
+      const auto& lvl = ns_->levels[r2l_lvl];
+      if ( ! r2l_posted) {
+        if (lvl.me.size()) r2l_irecv(lvl, r2l_grp);
+        r2l_posted = true;
+      }
+      if ( ! lvl.me.size() || ready(lvl.me_recv_req, l2r_grp == ngrp)) {
+        r2l_solve_qp(r2l_lvl, r2l_grp);
+        if (lvl.kids.size()) r2l_send_to_kids(lvl, r2l_grp);
+        r2l_posted = false;
+        if (r2l_lvl-- == 0) {
+          r2l_lvl = nlvl;
+          ++r2l_grp;
+        }
+      }
+    }
+  }
+}
+
 namespace test {
 using namespace impl;
 
@@ -648,9 +825,10 @@ public:
 
   TestQLT (const Parallel::Ptr& p, const tree::Node::Ptr& tree,
            const Int& ncells, const bool external_memory, const bool verbose,
-           CDR::Options options)
+           CDR::Options options, const Int ntracer_groups = 1)
     : TestRandomized("QLT", p, ncells, verbose, options),
-      qlt_(p, ncells, tree, options), tree_(tree), external_memory_(external_memory)
+      qlt_(p, ncells, tree, options), tree_(tree), external_memory_(external_memory),
+      ntracer_groups_(ntracer_groups)
   {
     if (verbose) qlt_.print(std::cout);
     init();
@@ -660,6 +838,7 @@ private:
   QLTT qlt_;
   tree::Node::Ptr tree_;
   bool external_memory_;
+  Int ntracer_groups_;
   typename QLTT::RealList buf1_, buf2_;
 
   CDR& get_cdr () override { return qlt_; }
@@ -694,7 +873,10 @@ private:
   void init_tracers () override {
     for (const auto& t : tracers_)
       qlt_.declare_tracer(t.problem_type, 0);
+    qlt_.set_num_tracer_groups(ntracer_groups_);
     qlt_.end_tracer_declarations();
+    cedr_assert(qlt_.get_num_tracer_groups() ==
+                std::min<Int>(ntracer_groups_, tracers_.size()));
     if (external_memory_) {
       size_t l2r_sz, r2l_sz;
       qlt_.get_buffers_sizes(l2r_sz, r2l_sz);
@@ -733,11 +915,12 @@ private:
 Int test_qlt (const Parallel::Ptr& p, const tree::Node::Ptr& tree,
               const Int& ncells, const Int nrepeat,
               const bool write, const bool external_memory,
-              const bool prefer_mass_con_to_bounds, const bool verbose) {
+              const bool prefer_mass_con_to_bounds, const bool verbose,
+              const Int ntracer_groups) {
   CDR::Options options;
   options.prefer_numerical_mass_conservation_to_numerical_bounds =
     prefer_mass_con_to_bounds;
-  return TestQLT(p, tree, ncells, external_memory, verbose, options)
+  return TestQLT(p, tree, ncells, external_memory, verbose, options, ntracer_groups)
     .run<TestQLT::QLTT>(nrepeat, write);
 }
 } // namespace test
@@ -752,18 +935,21 @@ Int unittest_QLT (const Parallel::Ptr& p, const bool write_requested=false) {
     for (size_t id = 0, idlim = sizeof(dists)/sizeof(*dists); id < idlim; ++id) {
       for (bool imbalanced : {false, true}) {
         for (bool prefer_mass_con_to_bounds : {false, true}) {
-          const auto external_memory = imbalanced;
-          if (p->amroot()) {
-            std::cout << " (" << szs[is] << ", " << id << ", " << imbalanced << ", "
-                      << prefer_mass_con_to_bounds << ")";
-            std::cout.flush();
+          for (Int ntracer_groups : {1, 3}) {
+            const auto external_memory = imbalanced;
+            if (p->amroot()) {
+              std::cout << " (" << szs[is] << ", " << id << ", " << imbalanced << ", "
+                        << prefer_mass_con_to_bounds << ", " << ntracer_groups << ")";
+              std::cout.flush();
+            }
+            Mesh m(szs[is], p, dists[id]);
+            tree::Node::Ptr tree = make_tree(m, imbalanced);
+            const bool write = (write_requested && m.ncell() < 3000 &&
+                                is == islim-1 && id == idlim-1 &&
+                                ntracer_groups == 1);
+            nerr += test::test_qlt(p, tree, m.ncell(), 1, write, external_memory,
+                                   prefer_mass_con_to_bounds, false, ntracer_groups);
           }
-          Mesh m(szs[is], p, dists[id]);
-          tree::Node::Ptr tree = make_tree(m, imbalanced);
-          const bool write = (write_requested && m.ncell() < 3000 &&
-                              is == islim-1 && id == idlim-1);
-          nerr += test::test_qlt(p, tree, m.ncell(), 1, write, external_memory,
-                                 prefer_mass_con_to_bounds, false);
         }
       }
     }
@@ -790,7 +976,8 @@ Int run_unit_and_randomized_tests (const Parallel::Ptr& p, const Input& in) {
     Timer::start(Timer::total); Timer::start(Timer::tree);
     tree::Node::Ptr tree = make_tree(m, false);
     Timer::stop(Timer::tree);
-    test::test_qlt(p, tree, in.ncells, in.nrepeat, false, false, false, in.verbose);
+    test::test_qlt(p, tree, in.ncells, in.nrepeat, false, false, false, in.verbose,
+                   std::max(1, in.ntracer_groups));
     Timer::stop(Timer::total);
     if (p->amroot()) Timer::print();
   }
@@ -38,6 +38,7 @@ protected:
   struct MetaDataBuilder {
     typedef std::shared_ptr<MetaDataBuilder> Ptr;
     std::vector<int> trcr2prob;
+    int ntracer_groups = 1;
   };
 
 public:
@@ -63,6 +64,14 @@ public:
       // Same for r2l bulk data.
       Int prob2br2l[nprobtypes + 1];
       IntListT trcr2br2l;
+      // Tracer groups; see set_num_tracer_groups. Group g has bulk indices
+      // grp2bidx(g) : grp2bidx(g+1)-1. Its l2r bulk data are the nslots*ndps
+      // values starting at nslots*grp2bl2r(g), where ndps = grp2bl2r(g+1) -
+      // grp2bl2r(g); each slot starts with rhom. Same for r2l bulk data, except
+      // for rhom. trcr2bl2r and trcr2br2l are relative to a group's slot. With
+      // one group, this is the same layout as described by prob2b{l2r,r2l}.
+      Int nslots;
+      IntListT trcr2grp, grp2bidx, grp2bl2r, grp2br2l;
     };
 
     KOKKOS_INLINE_FUNCTION static int get_problem_type(const int& idx);
@@ -101,7 +110,7 @@ public:
     Arrays<typename ConstUnmanagedIntList::HostMirror> a_h;
     Arrays<ConstUnmanagedIntList> a_d;
 
-    void init(const MetaDataBuilder& mdb);
+    void init(const MetaDataBuilder& mdb, const Int nslots);
 
   private:
     Arrays<typename IntList::HostMirror> a_h_;
@@ -149,6 +158,17 @@ public:
 
   void declare_tracer(int problem_type, const Int& rhomidx) override;
 
+  // Split the tracers into ngroups groups of about equal size. run() then
+  // pipelines the groups, overlapping the leaf-to-root communication of group
+  // g+1 with the root-to-leaf communication of group g. This hides some of the
+  // latency of the tree reductions when there are many tracers. Must be called
+  // before end_tracer_declarations; ngroups must be at most
+  // tree::NodeSets::max_ngrp and is limited to the number of tracers. The
+  // default is 1, i.e., no pipelining.
+  void set_num_tracer_groups(const Int ngroups);
+
+  Int get_num_tracer_groups() const;
+
   void end_tracer_declarations() override;
 
   void get_buffers_sizes(size_t& buf1, size_t& buf2) override;
@@ -209,13 +229,17 @@ protected:
   DeviceOp o;
 
 PRIVATE_CUDA:
-  void l2r_recv(const tree::NodeSets::Level& lvl, const Int& l2rndps) const;
-  void l2r_combine_kid_data(const Int& lvlidx, const Int& l2rndps) const;
-  void l2r_send_to_parents(const tree::NodeSets::Level& lvl, const Int& l2rndps) const;
-  void root_compute(const Int& l2rndps, const Int& r2lndps) const;
-  void r2l_recv(const tree::NodeSets::Level& lvl, const Int& r2lndps) const;
-  void r2l_solve_qp(const Int& lvlidx, const Int& l2rndps, const Int& r2lndps) const;
-  void r2l_send_to_kids(const tree::NodeSets::Level& lvl, const Int& r2lndps) const;
+  void l2r_irecv(const tree::NodeSets::Level& lvl, const Int& grp) const;
+  void l2r_recv(const tree::NodeSets::Level& lvl, const Int& grp) const;
+  void l2r_combine_kid_data(const Int& lvlidx, const Int& grp) const;
+  void l2r_send_to_parents(const tree::NodeSets::Level& lvl, const Int& grp) const;
+  void root_compute(const Int& grp) const;
+  void r2l_irecv(const tree::NodeSets::Level& lvl, const Int& grp) const;
+  void r2l_recv(const tree::NodeSets::Level& lvl, const Int& grp) const;
+  void r2l_solve_qp(const Int& lvlidx, const Int& grp) const;
+  void r2l_send_to_kids(const tree::NodeSets::Level& lvl, const Int& grp) const;
+  void run_pipelined() const;
+  int get_mpitag(const Int& grp) const;
 };
 
 namespace test {
@@ -223,6 +247,8 @@ struct Input {
   bool unittest, perftest, write;
   Int ncells, ntracers, tracer_type, nrepeat;
   bool pseudorandom, verbose;
+  // Number of tracer groups to pipeline in the perf test.
+  Int ntracer_groups = 1;
 };
 
 Int run_unit_and_randomized_tests(const Parallel::Ptr& p, const Input& in);
@@ -237,7 +263,9 @@ Int test_qlt(const Parallel::Ptr& p, const tree::Node::Ptr& tree, const Int& nce
              const bool external_memory,
              // Set CDR::Options.prefer_numerical_mass_conservation_to_numerical_bounds.
              const bool prefer_mass_con_to_bounds,
-             const bool verbose);
+             const bool verbose,
+             // Number of tracer groups to pipeline in QLT::run.
+             const Int ntracer_groups = 1);
 } // namespace test
 } // namespace qlt
 } // namespace cedr
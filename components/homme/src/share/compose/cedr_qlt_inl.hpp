@@ -14,8 +14,13 @@ namespace qlt {
 template <typename ES> KOKKOS_INLINE_FUNCTION
 void QLT<ES>::DeviceOp::
 set_rhom (const Int& lclcellidx, const Int& rhomidx, const Real& rhom) const {
-  const Int ndps = md_.a_d.prob2bl2r[md_.nprobtypes];
-  bd_.l2r_data(ndps*lclcellidx) = rhom;  
+  // Each tracer group has its own copy of rhom.
+  const auto& a = md_.a_d;
+  const Int ngrp = a.grp2bl2r.extent_int(0) - 1;
+  for (Int g = 0; g < ngrp; ++g) {
+    const Int ndps = a.grp2bl2r(g+1) - a.grp2bl2r(g);
+    bd_.l2r_data(a.nslots*a.grp2bl2r(g) + ndps*lclcellidx) = rhom;
+  }
 }
 
 template <typename ES> KOKKOS_INLINE_FUNCTION
@@ -24,11 +29,13 @@ set_Qm (const Int& lclcellidx, const Int& tracer_idx,
         const Real& Qm,
         const Real& Qm_min, const Real& Qm_max,
         const Real Qm_prev) const {
-  const Int ndps = md_.a_d.prob2bl2r[md_.nprobtypes];
-  Real* bd; {
-    const Int bdi = md_.a_d.trcr2bl2r(tracer_idx);
-    bd = &bd_.l2r_data(ndps*lclcellidx + bdi);
+  const auto& a = md_.a_d;
+  Int os; {
+    const Int g = a.trcr2grp(tracer_idx);
+    const Int ndps = a.grp2bl2r(g+1) - a.grp2bl2r(g);
+    os = a.nslots*a.grp2bl2r(g) + ndps*lclcellidx;
   }
+  Real* const bd = &bd_.l2r_data(os + a.trcr2bl2r(tracer_idx));
   {
     const Int problem_type = md_.a_d.trcr2prob(tracer_idx);
     Int next = 0;
@@ -38,7 +45,7 @@ set_Qm (const Int& lclcellidx, const Int& tracer_idx,
       bd[2] = Qm_max;
       next = 3;
     } else if (problem_type & ProblemType::consistent) {
-      const Real rhom = bd_.l2r_data(ndps*lclcellidx);
+      const Real rhom = bd_.l2r_data(os);
       bd[0] = Qm_min / rhom;
       bd[1] = Qm;
       bd[2] = Qm_max / rhom;
@@ -60,9 +67,11 @@ set_Qm (const Int& lclcellidx, const Int& tracer_idx,
 template <typename ES> KOKKOS_INLINE_FUNCTION
 Real QLT<ES>::DeviceOp::
 get_Qm (const Int& lclcellidx, const Int& tracer_idx) const {
-  const Int ndps = md_.a_d.prob2br2l[md_.nprobtypes];
-  const Int bdi = md_.a_d.trcr2br2l(tracer_idx);
-  return bd_.r2l_data(ndps*lclcellidx + bdi);
+  const auto& a = md_.a_d;
+  const Int g = a.trcr2grp(tracer_idx);
+  const Int ndps = a.grp2br2l(g+1) - a.grp2br2l(g);
+  return bd_.r2l_data(a.nslots*a.grp2br2l(g) + ndps*lclcellidx +
+                      a.trcr2br2l(tracer_idx));
 }
 
 //todo Replace this and the calling code with ReconstructSafely.
@@ -16,7 +16,10 @@ using cedr::mpi::Parallel;
 struct NodeSets {
   typedef std::shared_ptr<const NodeSets> ConstPtr;
   
-  enum : int { mpitag = 42 };
+  // MPI tags. Pipelined QLT uses the reserved range [mpitag_grp, mpitag_grp +
+  // max_ngrp), one tag per tracer group, so its messages cannot match those of
+  // any other CEDR reduction.
+  enum : int { mpitag = 42, mpitag_grp = 4096, max_ngrp = 1024 };
 
   // A node in the tree that is relevant to this rank.
   struct Node {
@@ -421,12 +421,13 @@ private:
 template <typename MT>
 CDR<MT>::CDR (Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int qsize_,
               bool use_sgi, bool independent_time_steps, const bool hard_zero_,
-              const Int* gid_data, const Int* rank_data,
+              const Int ntracer_groups_, const Int* gid_data, const Int* rank_data,
               const cedr::mpi::Parallel::Ptr& p_, Int fcomm)
   : alg(Alg::convert(cdr_alg_)),
     ncell(ngblcell_), nlclcell(nlclcell_), nlev(nlev_), qsize(qsize_),
     nsublev(Alg::is_suplev(alg) ? nsublev_per_suplev : 1),
     nsuplev((nlev + nsublev - 1) / nsublev),
+    ntracer_groups(ntracer_groups_),
     threed(independent_time_steps),
     cdr_over_super_levels(threed && Alg::is_caas(alg)),
     caas_in_suplev(alg == Alg::qlt_super_level_local_caas && nsublev > 1),
@@ -479,6 +480,13 @@ void CDR<MT>::init_tracers (const bool need_conservation) {
   for (Int ti = 0; ti < nt; ++ti)
     cdr->declare_tracer(PT::shapepreserve |
                         (need_conservation ? PT::conserve : 0), 0);
+  if (Alg::is_qlt(alg) && ntracer_groups > 1) {
+    // The vertical reconciliation for independent time steps is implemented
+    // only in the ungrouped QLT run.
+    cedr_throw_if(threed, "semi_lagrange_cdr_tracer_groups > 1 is not supported "
+                  "with dt_remap_factor < dt_tracer_factor.");
+    std::static_pointer_cast<QLTT>(cdr)->set_num_tracer_groups(ntracer_groups);
+  }
   cdr->end_tracer_declarations();
 }
 
@@ -627,11 +635,11 @@ cedr_init_impl (const homme::Int fcomm, const homme::Int cdr_alg, const bool use
                 const homme::Int gbl_ncell, const homme::Int lcl_ncell,
                 const homme::Int nlev, const homme::Int qsize,
                 const bool independent_time_steps, const bool hard_zero,
-                const homme::Int, const homme::Int) {
+                const homme::Int ntracer_groups, const homme::Int, const homme::Int) {
   const auto p = cedr::mpi::make_parallel(MPI_Comm_f2c(fcomm));
   g_cdr = std::make_shared<homme::CDR<ko::MachineTraits> >(
     cdr_alg, gbl_ncell, lcl_ncell, nlev, qsize, use_sgi,
-    independent_time_steps, hard_zero, gid_data, rank_data, p, fcomm);
+    independent_time_steps, hard_zero, ntracer_groups, gid_data, rank_data, p, fcomm);
 }
 
 extern "C" void cedr_query_bufsz (homme::Int* sendsz, homme::Int* recvsz) {
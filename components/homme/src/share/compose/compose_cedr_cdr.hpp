@@ -56,6 +56,8 @@ struct CDR {
   
   const Alg::Enum alg;
   const Int ncell, nlclcell, nlev, qsize, nsublev, nsuplev;
+  // Number of QLT tracer groups; see cedr::qlt::QLT::set_num_tracer_groups.
+  const Int ntracer_groups;
   const bool threed, cdr_over_super_levels, caas_in_suplev, hard_zero;
   const cedr::mpi::Parallel::Ptr p;
   cedr::tree::Node::Ptr tree; // Don't need this except for unit testing.
@@ -68,8 +70,9 @@ struct CDR {
   bool run; // for debugging, it can be useful not to run the CEDR.
 
   CDR(Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int qsize_, bool use_sgi,
-      bool independent_time_steps, const bool hard_zero_, const Int* gid_data,
-      const Int* rank_data, const cedr::mpi::Parallel::Ptr& p_, Int fcomm);
+      bool independent_time_steps, const bool hard_zero_, const Int ntracer_groups_,
+      const Int* gid_data, const Int* rank_data, const cedr::mpi::Parallel::Ptr& p_,
+      Int fcomm);
 
   CDR(const CDR&) = delete;
   CDR& operator=(const CDR&) = delete;
@@ -188,10 +188,19 @@ QLT<ES>::QLT (const cedr::mpi::Parallel::Ptr& p, const cedr::Int& ncells,
 
 template <typename ES>
 void QLT<ES>::run () {
-  if (ko::OnGpu<ES>::value)
+  if (ko::OnGpu<ES>::value) {
     Super::run();
-  else
+  } else if (this->get_num_tracer_groups() > 1) {
+    // runimpl uses the ungrouped bulk data layout. The pipelined run is not
+    // threaded, so just one thread runs it; the caller has barriers around
+    // this call.
+#ifdef COMPOSE_HORIZ_OPENMP
+#   pragma omp master
+#endif
+    Super::run();
+  } else {
     runimpl();
+  }
 }
 
 template <typename ES>
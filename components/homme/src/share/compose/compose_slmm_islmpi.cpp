@@ -71,10 +71,12 @@ int wait (Request* req, MPI_Status* stat) {
 
 namespace islmpi {
 namespace extend_halo {
-// Extend halo by one layer. This has two parts: finding neighbor (gid, rank) in
-// collect_gid_rank, and extending the Advecter local mesh geometry in
+// Extend halo by one or more layers. This has two parts: finding neighbor (gid,
+// rank) in collect_gid_rank, and extending the Advecter local mesh geometry in
 // extend_local_meshes. The two parts have the same comm pattern: in round 1,
-// request data for lists of GIDs; in round 2, fulfill these requests.
+// request data for lists of GIDs; in round 2, fulfill these requests. For each
+// layer beyond the second, collect_gid_rank does another pair of rounds;
+// extend_local_meshes handles all layers at once.
 
 typedef Int Gid;
 typedef Int Rank;
@@ -93,13 +95,16 @@ typedef std::map<Gid, GidRankPairs> Gid2Nbrs;
 typedef std::vector<Int> IntBuf;
 typedef std::vector<Real> RealBuf;
 
+// The 1-halo neighbors, i.e., the elements sharing an edge or corner with ed.
 template <typename MT>
 GidRankPairs all_nbrs_but_me (const typename IslMpi<MT>::ElemDataH& ed) {
   GidRankPairs gs;
-  gs.reserve(ed.nbrs.size() - 1);
-  for (const auto& n : ed.nbrs)
+  gs.reserve(ed.nin1halo - 1);
+  for (Int i = 0; i < ed.nin1halo; ++i) {
+    const auto& n = ed.nbrs(i);
     if (&n != ed.me)
       gs.push_back(GidRankPair(n.gid, n.rank));
+  }
   return gs;
 }
 
@@ -110,7 +115,8 @@ void fill_gid2nbrs (const mpi::Parallel& p, const typename IslMpi<MT>::ElemDataL
   const Rank my_rank = p.rank();
   const Int n_owned = eds.size();
 
-  // Fill in the ones we know.
+  // Fill in the ones we know. gid2nbrs may already have the 1-halo neighbors
+  // of the remote elements in the inner layers from a previous call.
   for (const auto& ed : eds) {
     slmm_assert(ed.me->rank == my_rank);
     gid2nbrs[ed.me->gid] = all_nbrs_but_me<MT>(ed);
@@ -121,17 +127,19 @@ void fill_gid2nbrs (const mpi::Parallel& p, const typename IslMpi<MT>::ElemDataL
   std::vector<IntBuf> req_sends, req_recvs;
   std::vector<mpi::Request> req_recv_reqs;
   {
-    // Find the ranks that know the rest.
+    // Find the ranks that know the rest. The neighbor relation is symmetric,
+    // so we exchange (possibly empty) requests with every rank in the current
+    // halo, and each of them does the same with us.
     std::map<Rank,Int> rank2rankidx;
     std::map<Gid,Rank> needgid2rank;
     {
       std::set<Rank> unique_ranks;
-      for (const auto& item : gid2nbrs)
-        for (const auto& n : item.second)
+      for (const auto& ed : eds)
+        for (const auto& n : ed.nbrs)
           if (n.rank != my_rank) {
-            slmm_assert(gid2nbrs.find(n.gid) == gid2nbrs.end());
-            needgid2rank.insert(std::make_pair(n.gid, n.rank));
             unique_ranks.insert(n.rank);
+            if (gid2nbrs.find(n.gid) == gid2nbrs.end())
+              needgid2rank.insert(std::make_pair(n.gid, n.rank));
           }
       nrank = unique_ranks.size();
       ranks.insert(ranks.begin(), unique_ranks.begin(), unique_ranks.end());
@@ -214,10 +222,12 @@ void fill_gid2nbrs (const mpi::Parallel& p, const typename IslMpi<MT>::ElemDataL
   mpi::waitall(nbr_send_reqs.size(), nbr_send_reqs.data());
 }
 
+// Add one layer to the halo of each element.
 template <typename MT>
-void extend_nbrs (const Gid2Nbrs& gid2nbrs, typename IslMpi<MT>::ElemDataListH& eds) {
+void extend_nbrs (const Gid2Nbrs& gid2nbrs, typename IslMpi<MT>::ElemDataListH& eds,
+                  const Int layer) {
   for (auto& ed : eds) {
-    // Get all <=2-halo neighbors.
+    // Get all neighbors of the current halo.
     std::set<GidRankPair> new_nbrs;
     for (const auto& n : ed.nbrs) {
       if (&n == ed.me) continue;
@@ -238,7 +248,7 @@ void extend_nbrs (const Gid2Nbrs& gid2nbrs, typename IslMpi<MT>::ElemDataListH&
         break;
       }
     slmm_assert(me >= 0);
-    // Append the, now only new, 2-halo ones.
+    // Append the, now only new, outer-layer ones.
     Int i = ed.nbrs.size();
     ed.nbrs.reset_capacity(i + new_nbrs.size(), true);
     ed.me = &ed.nbrs(me);
@@ -249,15 +259,19 @@ void extend_nbrs (const Gid2Nbrs& gid2nbrs, typename IslMpi<MT>::ElemDataListH&
       en.rank_idx = -1;
       en.lid_on_rank = -1;
       en.lid_on_rank_idx = -1;
+      en.layer = layer;
     }
   }
 }
 
 template <typename MT>
-void collect_gid_rank (const mpi::Parallel& p, typename IslMpi<MT>::ElemDataListH& eds) {
+void collect_gid_rank (const mpi::Parallel& p, typename IslMpi<MT>::ElemDataListH& eds,
+                       const Int halo) {
   Gid2Nbrs gid2nbrs;
-  fill_gid2nbrs<MT>(p, eds, gid2nbrs);
-  extend_nbrs<MT>(gid2nbrs, eds);
+  for (Int layer = 2; layer <= halo; ++layer) {
+    fill_gid2nbrs<MT>(p, eds, gid2nbrs);
+    extend_nbrs<MT>(gid2nbrs, eds, layer);
+  }
 }
 
 template <typename MT>
@@ -475,10 +489,11 @@ void collect_gid_rank (IslMpi<MT>& cm, const Int* nbr_id_rank, const Int* nirptr
       n.rank_idx = -1;
       n.lid_on_rank = -1;
       n.lid_on_rank_idx = -1;
+      n.layer = n.gid == mygid ? 0 : 1;
     }
     slmm_assert(ed.me);
   }
-  if (cm.halo == 2) extend_halo::collect_gid_rank<MT>(*cm.p, cm.ed_h);
+  if (cm.halo > 1) extend_halo::collect_gid_rank<MT>(*cm.p, cm.ed_h, cm.halo);
 #ifdef COMPOSE_PORT
   cm.own_dep_mask = typename IslMpi<MT>::DepMask("own_dep_mask",
                                                  cm.nelemd, cm.nlev, cm.np2);
@@ -763,6 +778,58 @@ void alloc_mpi_buffers (IslMpi<MT>& cm, Real* sendbuf, Real* recvbuf) {
 #endif  
 }
 
+#ifdef COMPOSE_PORT
+// Static (ri,lidi) -> (ptr,sci) reference lists for the count-then-scan
+// departure-point packing in pack_dep_points_sendbuf_pass2.
+template <typename MT>
+void init_pack_refs (IslMpi<MT>& cm) {
+  const auto myrank = cm.p->rank();
+  const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+  std::vector<Int> lidos(nrmtrank+1, 0);
+  for (Int ri = 0; ri < nrmtrank; ++ri)
+    lidos[ri+1] = lidos[ri] + cm.lid_on_rank_h(ri).n();
+  const Int nptr = cm.mylid_with_comm_h.n();
+  Int nnbr = 0;
+  std::vector<std::vector<std::pair<Int,Int> > > groups(lidos[nrmtrank]);
+  for (Int ptr = 0; ptr < nptr; ++ptr) {
+    const auto& ed = cm.ed_h(cm.mylid_with_comm_h(ptr));
+    nnbr = std::max(nnbr, static_cast<Int>(ed.nbrs.size()));
+    for (Int sci = 0; sci < ed.nbrs.size(); ++sci) {
+      const auto& n = ed.nbrs(sci);
+      if (n.rank == myrank) continue;
+      groups[lidos[n.rank_idx] + n.lid_on_rank_idx].push_back(std::make_pair(ptr, sci));
+    }
+  }
+  Int nref = 0;
+  for (const auto& g: groups) nref += g.size();
+  cm.npack_ref = nref;
+  cm.pack_ref = typename IslMpi<MT>::PackRefList("pack_ref", nref);
+  cm.pack_ref_idx = typename IslMpi<MT>::template ArrayD<Int**>("pack_ref_idx",
+                                                                nptr, nnbr);
+  const auto pack_ref_h = ko::create_mirror_view(cm.pack_ref);
+  const auto pack_ref_idx_h = ko::create_mirror_view(cm.pack_ref_idx);
+  ko::deep_copy(pack_ref_idx_h, -1);
+  Int j = 0;
+  for (const auto& g: groups) {
+    const Int beg = j;
+    for (const auto& e: g) {
+      pack_ref_h(j,0) = e.first;
+      pack_ref_h(j,1) = e.second;
+      pack_ref_h(j,2) = beg;
+      pack_ref_idx_h(e.first, e.second) = j;
+      ++j;
+    }
+  }
+  slmm_assert(j == nref);
+  ko::deep_copy(cm.pack_ref, pack_ref_h);
+  ko::deep_copy(cm.pack_ref_idx, pack_ref_idx_h);
+  cm.pack_ref_os = typename IslMpi<MT>::template ArrayD<Int*>(
+    "pack_ref_os", cm.nlev*nref + 1);
+  cm.pack_rmt_os = typename IslMpi<MT>::template ArrayD<Int*>(
+    "pack_rmt_os", nptr*cm.nlev + 1);
+}
+#endif
+
 // At simulation initialization, set up a bunch of stuff to make the work at
 // each step as small as possible.
 template <typename MT>
@@ -775,6 +842,9 @@ void setup_comm_pattern (IslMpi<MT>& cm, const Int* nbr_id_rank, const Int* nirp
     comm_lid_on_rank(cm, rank2rmtgids, rank2owngids, gid2rmt_owning_lid);
     set_idx2_maps(cm, rank2rmtgids, gid2rmt_owning_lid);
   }
+#ifdef COMPOSE_PORT
+  init_pack_refs(cm);
+#endif
   size_mpi_buffers(cm, rank2rmtgids, rank2owngids);
 }
 
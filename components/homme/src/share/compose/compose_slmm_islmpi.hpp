@@ -459,7 +459,8 @@ struct GidRank {
     rank,     // the rank that owns the cell
     rank_idx, // index into list of ranks with whom I communicate, including me
     lid_on_rank,     // the local ID of the cell on the owning rank
-    lid_on_rank_idx; // index into list of LIDs on the rank
+    lid_on_rank_idx, // index into list of LIDs on the rank
+    layer;           // halo layer of the cell: 0 for the owned cell, 1 for the 1-halo, ...
 };
 struct OwnItem {
   short lev;   // level index
@@ -509,6 +510,13 @@ struct IslMpi {
   typedef FixedCapList<ElemDataH, HDT> ElemDataListH;
   typedef FixedCapList<ElemDataD, DDT> ElemDataListD;
 
+  // Number of element layers around an owned cell in which departure points
+  // can be found. Every tracer step still does one departure point/q exchange
+  // round; a wider halo reduces the number of rounds per simulated time only
+  // by permitting a longer tracer time step, at the cost of larger messages to
+  // more ranks.
+  enum : Int { max_halo = 4 };
+
   const mpi::Parallel::Ptr p;
   const typename Advecter::ConstPtr advecter;
   const Int np, np2, nlev, qsize, qsized, nelemd, halo;
@@ -558,12 +566,35 @@ struct IslMpi {
   DepList own_dep_list;
   Int own_dep_list_len;
 
+  // Deterministic departure-point packing. pack_ref lists, for each remote
+  // (ri,lidi) in bla order, the (ptr,sci) pairs of my elements with comm that
+  // have (ri,lidi) as nbr sci, in increasing ptr, along with the index of the
+  // group's first pair. pack_ref_idx(ptr,sci) is the inverse map. pack_ref_os
+  // and pack_rmt_os hold counts, then exclusive scans, by (lev,pack_ref) and
+  // (ptr,lev), respectively, each with a trailing total.
+  typedef ArrayD<Int*[3]> PackRefList;
+  PackRefList pack_ref;
+  ArrayD<Int**> pack_ref_idx;
+  ArrayD<Int*> pack_ref_os, pack_rmt_os;
+  Int npack_ref;
+
+  // Optional departure point statistics, used to test the halo width. If
+  // track_dep_stats, step() accumulates the number of exchange rounds, the
+  // outermost halo layer in which a departure point was found, and the number
+  // of departure points that left the halo and were moved to the nearest point
+  // in it.
+  bool track_dep_stats;
+  Int dep_stats_nexchange, dep_stats_max_layer;
+  ArrayD<Int*> dep_stats_nnearest;
+
   IslMpi (const mpi::Parallel::Ptr& ip, const typename Advecter::ConstPtr& advecter,
           const typename TracerArrays<MT>::Ptr& tracer_arrays_,
           Int inp, Int inlev, Int iqsize, Int iqsized, Int inelemd, Int ihalo)
     : p(ip), advecter(advecter),
       np(inp), np2(np*np), nlev(inlev), qsize(iqsize), qsized(iqsized), nelemd(inelemd),
-      halo(ihalo), tracer_arrays(tracer_arrays_)
+      halo(ihalo), tracer_arrays(tracer_arrays_), npack_ref(0),
+      track_dep_stats(false), dep_stats_nexchange(0), dep_stats_max_layer(0),
+      dep_stats_nnearest("dep_stats_nnearest", 1)
   {}
 
   IslMpi(const IslMpi&) = delete;
@@ -622,6 +653,9 @@ template <typename MT>
 void analyze_dep_points(IslMpi<MT>& cm, const Int& nets, const Int& nete,
                         const DepPoints<MT>& dep_points);
 
+template <typename MT>
+void accumulate_dep_stats(IslMpi<MT>& cm, const Int& nets, const Int& nete);
+
 template <typename MT>
 void init_mylid_with_comm_threaded(IslMpi<MT>& cm, const Int& nets, const Int& nete);
 template <typename MT>
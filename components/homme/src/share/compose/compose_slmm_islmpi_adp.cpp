@@ -87,6 +87,8 @@ void analyze_dep_points (IslMpi<MT>& cm, const Int& nets, const Int& nete,
     const auto& nx_in_lid = cm.nx_in_lid;
     const auto& bla = cm.bla;
     const auto& nx_in_rank = cm.nx_in_rank;
+    const bool track_dep_stats = cm.track_dep_stats;
+    const auto& nnearest = cm.dep_stats_nnearest;
     const auto f = COMPOSE_LAMBDA (const Int& ki) {
       const Int tci = nets + ki/(nlev*np2);
       const Int   k = (ki/nlev) % np2;
@@ -98,7 +100,11 @@ void analyze_dep_points (IslMpi<MT>& cm, const Int& nets, const Int& nete,
       if (sci == -1) {
         const bool npp = slmm::Advecter<MT>::nearest_point_permitted(
           nearest_point_permitted_lev_bdy, lev);
-        if (npp) sci = slmm::get_nearest_point(mesh, &dep_points(tci,lev,k,0), tgt_idx);
+        if (npp) {
+          sci = slmm::get_nearest_point(mesh, &dep_points(tci,lev,k,0), tgt_idx);
+          if (track_dep_stats)
+            ko::atomic_increment(static_cast<volatile Int*>(&nnearest(0)));
+        }
         if (sci == -1) throw_on_sci_error<MT>(mesh, ed, npp, dep_points, k, lev, tci);
       }
       ed.src(lev,k) = sci;
@@ -149,6 +155,8 @@ void analyze_dep_points (IslMpi<MT>& cm, const Int& nets, const Int& nete,
     const auto& ed_d = cm.ed_d;
     const auto& bla = cm.bla;
     const auto& nx_in_lid = cm.nx_in_lid;
+    const bool track_dep_stats = cm.track_dep_stats;
+    const auto& nnearest = cm.dep_stats_nnearest;
 #ifdef COMPOSE_HORIZ_OPENMP
     const auto horiz_openmp = cm.horiz_openmp;
     const auto& ri_lidi_locks = cm.ri_lidi_locks;
@@ -171,7 +179,11 @@ void analyze_dep_points (IslMpi<MT>& cm, const Int& nets, const Int& nete,
       if (sci == -1) {
         const bool npp = slmm::Advecter<MT>::nearest_point_permitted(
           nearest_point_permitted_lev_bdy, lev);
-        if (npp) sci = slmm::get_nearest_point(mesh, &dep_points(tci,lev,k,0), tgt_idx);
+        if (npp) {
+          sci = slmm::get_nearest_point(mesh, &dep_points(tci,lev,k,0), tgt_idx);
+          if (track_dep_stats)
+            ko::atomic_increment(static_cast<volatile Int*>(&nnearest(0)));
+        }
         if (sci == -1) throw_on_sci_error<MT>(mesh, ed, npp, dep_points, k, lev, tci);
       }
       ed.src(lev,k) = sci;
@@ -213,6 +225,39 @@ void analyze_dep_points (IslMpi<MT>& cm, const Int& nets, const Int& nete,
 #endif
 }
 
+// Accumulate departure point statistics for this step. The src cell of each
+// departure point was found in analyze_dep_points.
+template <typename MT>
+void accumulate_dep_stats (IslMpi<MT>& cm, const Int& nets, const Int& nete) {
+  const Int np2 = cm.np2, nlev = cm.nlev;
+  const auto& ed_d = cm.ed_d;
+  const auto f = COMPOSE_LAMBDA (const Int& ki, Int& max_layer) {
+    const Int tci = nets + ki/(nlev*np2);
+    const Int   k = (ki/nlev) % np2;
+    const Int lev = ki % nlev;
+    const auto& ed = ed_d(tci);
+    const Int layer = ed.nbrs(ed.src(lev,k)).layer;
+    if (layer > max_layer) max_layer = layer;
+  };
+  Int max_layer = 0;
+  ko::fence();
+  ko::parallel_reduce(ko::RangePolicy<typename MT::DES>(0, (nete - nets + 1)*nlev*np2),
+                      f, ko::Max<Int>(max_layer));
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp critical
+#endif
+  {
+    cm.dep_stats_max_layer = std::max(cm.dep_stats_max_layer, max_layer);
+  }
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp master
+#endif
+  ++cm.dep_stats_nexchange;
+}
+
+template void
+accumulate_dep_stats(IslMpi<ko::MachineTraits>& cm, const Int& nets, const Int& nete);
+
 template void
 analyze_dep_points(IslMpi<ko::MachineTraits>& cm, const Int& nets,
                    const Int& nete, const DepPoints<ko::MachineTraits>& dep_points);
@@ -219,17 +219,122 @@ void pack_dep_points_sendbuf_pass1 (IslMpi<MT>& cm) {
     pack_dep_points_sendbuf_pass1_noscan(cm);
 }
 
+#ifdef COMPOSE_PORT
+// Exclusive scan of v(0:n-1) in place; v(n) receives the total. Each entry is
+// read before the same iteration overwrites it.
+template <typename MT, typename View>
+void exclusive_scan_in_place (const View& v, const Int& n) {
+  const auto f = COMPOSE_LAMBDA (const Int& i, Int& a, const bool fin) {
+    const Int c = i < n ? v(i) : 0;
+    if (fin) v(i) = a;
+    a += c;
+  };
+  ko::parallel_scan(ko::RangePolicy<typename MT::DES>(0, n+1), f);
+}
+
+/* Pack the departure points without atomics. A point's slot in its
+   (ri,lidi,lev) x bulk data is its rank among that triple's points in (ptr,k)
+   order, and its slot in ed.rmt is its rank among the element's remote points
+   in (lev,k) order. We count points per (lev,pack_ref) and per (ptr,lev),
+   exclusive-scan the counts, and finish with the rank within (ptr,lev), a short
+   loop over k. The send buffers and rmt lists are thus the same in every run.
+*/
 template <typename MT>
-void pack_dep_points_sendbuf_pass2 (IslMpi<MT>& cm, const DepPoints<MT>& dep_points) {
+void pack_dep_points_sendbuf_pass2_scan (IslMpi<MT>& cm,
+                                         const DepPoints<MT>& dep_points) {
   const auto myrank = cm.p->rank();
-#ifdef COMPOSE_PORT
-  const Int start = 0, end = cm.mylid_with_comm_h.n();
+  const Int nptr = cm.mylid_with_comm_h.n(), nref = cm.npack_ref;
+  const Int np2 = cm.np2, nlev = cm.nlev, qsize = cm.qsize;
+  const auto& ed_d = cm.ed_d;
+  const auto& mylid_with_comm = cm.mylid_with_comm_d;
+  const auto& pack_ref = cm.pack_ref;
+  const auto& pack_ref_idx = cm.pack_ref_idx;
+  const auto& ref_os = cm.pack_ref_os;
+  const auto& rmt_os = cm.pack_rmt_os;
+  const auto& sendbuf = cm.sendbuf;
+  const auto& x_bulkdata_offset = cm.x_bulkdata_offset;
+  const auto& bla = cm.bla;
+  ko::fence();
+  { // Count.
+    const auto f = COMPOSE_LAMBDA (const Int& i) {
+      Int cnt = 0;
+      if (i < nlev*nref) {
+        const Int lev = i / nref, j = i % nref;
+        const auto& ed = ed_d(mylid_with_comm(pack_ref(j,0)));
+        const Int sci = pack_ref(j,1);
+        for (Int k = 0; k < np2; ++k)
+          if (ed.src(lev,k) == sci) ++cnt;
+        ref_os(i) = cnt;
+      } else {
+        const Int ip = i - nlev*nref;
+        const Int ptr = ip / nlev, lev = ip % nlev;
+        const auto& ed = ed_d(mylid_with_comm(ptr));
+        for (Int k = 0; k < np2; ++k)
+          if (ed.nbrs(ed.src(lev,k)).rank != myrank) ++cnt;
+        rmt_os(ip) = cnt;
+      }
+    };
+    ko::parallel_for(
+      ko::RangePolicy<typename MT::DES>(0, nlev*nref + nptr*nlev), f);
+  }
+  // Scan.
+  exclusive_scan_in_place<MT>(ref_os, nlev*nref);
+  exclusive_scan_in_place<MT>(rmt_os, nptr*nlev);
+  {
+    const auto f = COMPOSE_LAMBDA (const Int& ptr) {
+      ed_d(mylid_with_comm(ptr)).rmt.set_n(rmt_os((ptr+1)*nlev) - rmt_os(ptr*nlev));
+    };
+    ko::parallel_for(ko::RangePolicy<typename MT::DES>(0, nptr), f);
+  }
+  { // Pack.
+    const auto f = COMPOSE_LAMBDA (const Int& ki) {
+      const Int ptr = ki/(nlev*np2);
+      const Int lev = (ki/np2) % nlev;
+      const Int k = ki % np2;
+      const Int tci = mylid_with_comm(ptr);
+      const auto& ed = ed_d(tci);
+      const Int sci = ed.src(lev,k);
+      const auto& nbr = ed.nbrs(sci);
+      if (nbr.rank == myrank) return;
+      const Int ri = nbr.rank_idx;
+      const Int lidi = nbr.lid_on_rank_idx;
+      Int nprev = 0, nprev_rmt = 0;
+      for (Int kp = 0; kp < k; ++kp) {
+        const Int s = ed.src(lev,kp);
+        if (s == sci) {
+          ++nprev;
+          ++nprev_rmt;
+        } else if (ed.nbrs(s).rank != myrank) {
+          ++nprev_rmt;
+        }
+      }
+      const Int j = pack_ref_idx(ptr,sci);
+      slmm_kernel_assert_high(j >= 0);
+      const Int cnt = ref_os(lev*nref + j) - ref_os(lev*nref + pack_ref(j,2)) + nprev;
+      const auto& t = bla(ri,lidi,lev);
+      const Int xptr = x_bulkdata_offset(ri) + t.xptr + 3*cnt;
+      slmm_kernel_assert_high(xptr > 0);
+      auto&& sb = sendbuf(ri);
+      for (Int i = 0; i < 3; ++i)
+        sb(xptr + i) = dep_points(tci,lev,k,i);
+      auto& item = ed.rmt(rmt_os(ptr*nlev + lev) - rmt_os(ptr*nlev) + nprev_rmt);
+      item.q_extrema_ptr = qsize * t.qptr;
+      item.q_ptr = item.q_extrema_ptr + qsize*(2 + cnt);
+      item.lev = lev;
+      item.k = k;
+    };
+    ko::parallel_for(ko::RangePolicy<typename MT::DES>(0, nptr*nlev*np2), f);
+  }
+  ko::fence();
+}
 #else
+template <typename MT>
+void pack_dep_points_sendbuf_pass2_lock (IslMpi<MT>& cm, const DepPoints<MT>& dep_points) {
+  const auto myrank = cm.p->rank();
   const int tid = get_tid();
   ConstExceptGnu Int
     start = cm.mylid_with_comm_tid_ptr_h(tid),
     end = cm.mylid_with_comm_tid_ptr_h(tid+1);
-#endif
   {
     auto ed = cm.ed_d.unmanaged();
     const auto mylid_with_comm = cm.mylid_with_comm_d.unmanaged();
@@ -272,12 +377,8 @@ void pack_dep_points_sendbuf_pass2 (IslMpi<MT>& cm, const DepPoints<MT>& dep_poi
 #endif
       Int xptr, qptr, cnt; {
         auto& t = bla(ri,lidi,lev);
-#ifdef COMPOSE_PORT
-        cnt = ko::atomic_fetch_add(static_cast<volatile Int*>(&t.cnt), 1);
-#else
         cnt = t.cnt;
         ++t.cnt;
-#endif
         qptr = t.qptr;
         xptr = x_bulkdata_offset(ri) + t.xptr + 3*cnt;
       }
@@ -299,6 +400,16 @@ void pack_dep_points_sendbuf_pass2 (IslMpi<MT>& cm, const DepPoints<MT>& dep_poi
     ko::fence();
   }
 }
+#endif
+
+template <typename MT>
+void pack_dep_points_sendbuf_pass2 (IslMpi<MT>& cm, const DepPoints<MT>& dep_points) {
+#ifdef COMPOSE_PORT
+  pack_dep_points_sendbuf_pass2_scan(cm, dep_points);
+#else
+  pack_dep_points_sendbuf_pass2_lock(cm, dep_points);
+#endif
+}
 
 template void pack_dep_points_sendbuf_pass1(IslMpi<ko::MachineTraits>& cm);
 template void pack_dep_points_sendbuf_pass2(IslMpi<ko::MachineTraits>& cm,
@@ -78,6 +78,10 @@ void step (
   // Wait on send buffer so it's free to be used by others.
   { Timer t("15_wait_on_send");
     wait_on_send(cm, true /* skip_if_empty */); }
+  if (cm.track_dep_stats) {
+    Timer t("16_dep_stats");
+    accumulate_dep_stats(cm, nets, nete);
+  }
 }
 
 template void step(IslMpi<ko::MachineTraits>&, const Int, const Int, Real*, Real*, Real*);
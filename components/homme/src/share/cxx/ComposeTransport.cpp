@@ -86,6 +86,11 @@ void ComposeTransport::test_2d (const bool bfb, const int nstep, std::vector<Rea
   m_compose_impl->test_2d(bfb, nstep, eval);
 }
 
+int ComposeTransport::test_substeps (const int nstep, const int nsubstep) {
+  assert(is_setup);
+  return m_compose_impl->test_substeps(nstep, nsubstep);
+}
+
 } // Namespace Homme
 
 #endif // HOMME_ENABLE_COMPOSE
@@ -47,6 +47,7 @@ public:
   TestDepView::HostMirror test_trajectory(Real t0, Real t1, bool independent_time_steps);
 
   void test_2d(const bool bfb, const int nstep, std::vector<Real>& eval);
+  int test_substeps(const int nstep, const int nsubstep);
 
 private:
   std::unique_ptr<ComposeTransportImpl> m_compose_impl;
@@ -59,16 +59,26 @@ struct ComposeTransportImpl {
     int geometry_type; // 0: sphere, 1: plane
     Real nu_q, hv_scaling, dp_tol;
     bool independent_time_steps;
+    // Adaptive substepping: nsubstep_max > 1 enables it; nsubstep is the count
+    // used in the most recent step.
+    int nsubstep_max, nsubstep;
+    Real courant_max;
 
     Buf1 buf1[3];
     Buf2 buf2[2];
 
     DeparturePoints dep_pts;
 
+    // Start-of-step velocity and dp and end-of-step dp, from which substep
+    // values are interpolated, and the end-of-substep velocity. Allocated only
+    // if nsubstep_max > 1.
+    ExecViewManaged<Scalar*[2][NP][NP][NUM_LEV]> v0, v1;
+    ExecViewManaged<Scalar*[NP][NP][NUM_LEV]> dp0, dp1;
+
     Data ()
       : nelemd(-1), qsize(-1), limiter_option(9), cdr_check(0), hv_q(0),
         hv_subcycle_q(0), geometry_type(0), nu_q(0), hv_scaling(0), dp_tol(-1),
-        independent_time_steps(false)
+        independent_time_steps(false), nsubstep_max(1), nsubstep(1), courant_max(1)
     {}
   };
 
@@ -86,7 +96,9 @@ struct ComposeTransportImpl {
   TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_qsize, m_tu_ne_hv_q;
 
   std::shared_ptr<BoundaryExchange>
-    m_qdp_dss_be[Q_NUM_TIME_LEVELS], m_v_dss_be[2], m_hv_dss_be[2];
+    m_qdp_dss_be[Q_NUM_TIME_LEVELS], m_v_dss_be[2], m_hv_dss_be[2],
+    // qdp only, for all but the last substep.
+    m_qdp_only_dss_be[Q_NUM_TIME_LEVELS];
 
   ComposeTransportImpl();
   ComposeTransportImpl(const int num_elems);
@@ -107,7 +119,14 @@ struct ComposeTransportImpl {
   void run(const TimeLevel& tl, const Real dt);
   void remap_q(const TimeLevel& tl);
 
-  void calc_trajectory(const int np1, const Real dt);
+  // If substep, the end-of-substep velocity is in m_data.v1.
+  void calc_trajectory(const int np1, const Real dt, const bool substep = false);
+  Real calc_max_courant_number();
+  // omega_p is DSSed with q only if dss_omega; it is accumulated once per
+  // tracer step, so it must be DSSed once per step.
+  void advance_sl(const TimeLevel& tl, const Real dt, const bool dss_omega = true);
+  void init_substeps();
+  void run_substeps(const TimeLevel& tl, const Real dt, const int nsubstep);
   void remap_v(const ExecViewUnmanaged<const Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV]>& dp3d,
                const int np1, const ExecViewUnmanaged<const Scalar*[NP][NP][NUM_LEV]>& dp,
                const ExecViewUnmanaged<Scalar*[2][NP][NP][NUM_LEV]>& v);
@@ -121,6 +140,10 @@ struct ComposeTransportImpl {
   // In test code, the bfb flag says to construct manufactured fields on host to
   // avoid non-bfb-ness in, e.g., trig functions.
   void test_2d(const bool bfb, const int nstep, std::vector<Real>& eval);
+  // Check that forced SL substeps in a steady wind match plain steps of the
+  // substep length and leave vn0 alone, and that the Courant number scales
+  // with dt. Returns the number of failures.
+  int test_substeps(const int nstep, const int nsubstep);
 
   template <int KLIM, typename Fn> KOKKOS_INLINE_FUNCTION
   static void loop_ijk (const KernelVariables& kv, const Fn& h) {
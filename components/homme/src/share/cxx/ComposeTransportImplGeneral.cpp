@@ -10,9 +10,13 @@
 #include "ComposeTransportImpl.hpp"
 #include "compose_hommexx.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 extern "C" void
 sl_get_params(double* nu_q, double* hv_scaling, int* hv_q, int* hv_subcycle_q,
-              int* limiter_option, int* cdr_check, int* geometry_type);
+              int* limiter_option, int* cdr_check, int* geometry_type,
+              int* nsubstep_max, double* courant_max);
 
 namespace Homme {
 
@@ -87,11 +91,19 @@ void ComposeTransportImpl::reset (const SimulationParams& params) {
   m_data.nelemd = num_elems;
 
   sl_get_params(&m_data.nu_q, &m_data.hv_scaling, &m_data.hv_q, &m_data.hv_subcycle_q,
-                &m_data.limiter_option, &m_data.cdr_check, &m_data.geometry_type);
+                &m_data.limiter_option, &m_data.cdr_check, &m_data.geometry_type,
+                &m_data.nsubstep_max, &m_data.courant_max);
   Errors::runtime_check(m_data.hv_q >= 0 && m_data.hv_q <= m_data.qsize,
                         "semi_lagrange_hv_q should be in [0, qsize].");
   Errors::runtime_check(m_data.hv_subcycle_q >= 0,
                         "hypervis_subcycle_q should be >= 0.");
+  Errors::runtime_check(m_data.nsubstep_max >= 1,
+                        "semi_lagrange_nsubstep_max should be >= 1.");
+  Errors::runtime_check(m_data.nsubstep_max == 1 || m_data.courant_max > 0,
+                        "semi_lagrange_courant_max should be > 0.");
+  Errors::runtime_check(m_data.nsubstep_max == 1 || ! m_data.independent_time_steps,
+                        "semi_lagrange_nsubstep_max > 1 requires "
+                        "dt_remap_factor >= dt_tracer_factor.");
 
   m_tp_ne = Homme::get_default_team_policy<ExecSpace>(m_data.nelemd);
   m_tp_ne_qsize = Homme::get_default_team_policy<ExecSpace>(m_data.nelemd * m_data.qsize);
@@ -106,9 +118,10 @@ void ComposeTransportImpl::reset (const SimulationParams& params) {
 
   if (Context::singleton().get<Connectivity>().get_comm().root())
     printf("compose> nelemd %d qsize %d hv_q %d hv_subcycle_q %d lim %d "
-           "independent_time_steps %d\n",
+           "independent_time_steps %d nsubstep_max %d courant_max %1.2f\n",
            m_data.nelemd, m_data.qsize, m_data.hv_q, m_data.hv_subcycle_q,
-           m_data.limiter_option, (int) m_data.independent_time_steps);
+           m_data.limiter_option, (int) m_data.independent_time_steps,
+           m_data.nsubstep_max, m_data.courant_max);
 }
 
 int ComposeTransportImpl::requested_buffer_size () const {
@@ -176,13 +189,70 @@ void ComposeTransportImpl::init_boundary_exchanges () {
       be->registration_completed();
     }
   }
+
+  init_substeps();
+}
+
+// Allocate the substep buffers and DSS exchanges if nsubstep_max > 1 and they
+// do not exist yet. Separate from reset so tests can turn substepping on.
+void ComposeTransportImpl::init_substeps () {
+  if (m_data.nsubstep_max == 1 || m_data.v0.size() > 0) return;
+
+  m_data.v0 = decltype(m_data.v0)("ComposeTransport-v0", m_data.nelemd);
+  m_data.v1 = decltype(m_data.v1)("ComposeTransport-v1", m_data.nelemd);
+  m_data.dp0 = decltype(m_data.dp0)("ComposeTransport-dp0", m_data.nelemd);
+  m_data.dp1 = decltype(m_data.dp1)("ComposeTransport-dp1", m_data.nelemd);
+
+  auto bm_exchange = Context::singleton().get<MpiBuffersManagerMap>()[MPI_EXCHANGE];
+  const auto& sp = Context::singleton().get<SimulationParams>();
+  for (int i = 0; i < Q_NUM_TIME_LEVELS; ++i) {
+    m_qdp_only_dss_be[i] = std::make_shared<BoundaryExchange>();
+    auto be = m_qdp_only_dss_be[i];
+    be->set_label(std::string("ComposeTransport-qdp-only-DSS-" + std::to_string(i)));
+    be->set_diagnostics_level(sp.internal_diagnostics_level);
+    be->set_buffers_manager(bm_exchange);
+    be->set_num_fields(0, 0, m_data.qsize);
+    be->register_field(m_tracers.qdp, i, m_data.qsize, 0);
+    be->registration_completed();
+  }
 }
 
 void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
   GPTLstart("compose_transport");
 
+  const bool adapt = m_data.nsubstep_max > 1;
+  if (adapt) Kokkos::deep_copy(m_data.v0, m_derived.m_vstar);
+
   calc_trajectory(tl.np1, dt);
+
+  m_data.nsubstep = 1;
+  if (adapt) {
+    GPTLstart("compose_courant");
+    const Real courant = calc_max_courant_number();
+    // Compare before converting to int, as courant/courant_max can be huge.
+    const Real n = std::ceil(courant/m_data.courant_max);
+    m_data.nsubstep = n >= m_data.nsubstep_max ? m_data.nsubstep_max : std::max(1, int(n));
+    GPTLstop("compose_courant");
+  }
+
+  if (m_data.nsubstep == 1)
+    advance_sl(tl, dt);
+  else
+    run_substeps(tl, dt, m_data.nsubstep);
+
+  if (m_data.cdr_check) {
+    GPTLstart("compose_cedr_check");
+    homme::compose::property_preserve_check();
+    Kokkos::fence();
+    GPTLstop("compose_cedr_check");
+  }
   
+  GPTLstop("compose_transport");
+}
+
+// Given departure points, advect, limit, and DSS q over one SL step.
+void ComposeTransportImpl::advance_sl (const TimeLevel& tl, const Real dt,
+                                       const bool dss_omega) {
   GPTLstart("compose_isl");
   homme::compose::advect(tl.np1, tl.n0_qdp, tl.np1_qdp);
   GPTLstop("compose_isl");
@@ -237,26 +307,93 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
       qdp(ie,np1_qdp,q,i,j,lev) *= spheremp(ie,i,j);
     };
     launch_ie_q_ij_nlev<num_lev_pack>(qsize, f1);
-    const auto omega = m_derived.m_omega_p;
-    const auto f2 = KOKKOS_LAMBDA (const int idx) {
+    if (dss_omega) {
+      const auto omega = m_derived.m_omega_p;
+      const auto f2 = KOKKOS_LAMBDA (const int idx) {
+        int ie, i, j, lev;
+        idx_ie_ij_nlev<num_lev_pack>(idx, ie, i, j, lev);
+        omega(ie,i,j,lev) *= spheremp(ie,i,j);
+      };
+      launch_ie_ij_nlev<num_lev_pack>(f2);
+      m_qdp_dss_be[tl.np1_qdp]->exchange(m_geometry.m_rspheremp);
+    } else {
+      m_qdp_only_dss_be[tl.np1_qdp]->exchange(m_geometry.m_rspheremp);
+    }
+    Kokkos::fence();
+    GPTLstop("compose_dss_q");
+  }
+}
+
+/* Split the step [t0,t1] into nsubstep SL steps. Velocity and dp at substep
+   boundaries are interpolated linearly in time between the start-of-step
+   values, saved in v0 and dp0, and the end-of-step values, v(np1) and
+   dp3d(np1). The substep's start velocity goes in vstar, which calc_trajectory
+   overwrites in any case, and its end velocity in v1, so vn0 is untouched.
+   Each substep reads q from qdp(n0_qdp) and writes qdp(np1_qdp); between
+   substeps, the latter is copied to the former. The final substep's target dp
+   is exactly dp3d(np1), so the last substep leaves qdp(np1_qdp) consistent
+   with the dynamics. omega_p is DSSed in the last substep only. m_dp and
+   dp3d(np1) are restored at the end.
+*/
+void ComposeTransportImpl::run_substeps (const TimeLevel& tl, const Real dt,
+                                         const int nsubstep) {
+  GPTLstart("compose_substeps");
+  const auto np1 = tl.np1, n0_qdp = tl.n0_qdp, np1_qdp = tl.np1_qdp;
+  const auto qsize = m_data.qsize;
+  const auto v = m_state.m_v;
+  const auto dp3d = m_state.m_dp3d;
+  const auto dp = m_derived.m_dp;
+  const auto vstar = m_derived.m_vstar;
+  const auto qdp = m_tracers.qdp;
+  const auto v0 = m_data.v0;
+  const auto v1 = m_data.v1;
+  const auto dp0 = m_data.dp0;
+  const auto dp1 = m_data.dp1;
+  {
+    const auto f = KOKKOS_LAMBDA (const int idx) {
+      int ie, i, j, lev;
+      idx_ie_ij_nlev<num_lev_pack>(idx, ie, i, j, lev);
+      dp0(ie,i,j,lev) = dp(ie,i,j,lev);
+      dp1(ie,i,j,lev) = dp3d(ie,np1,i,j,lev);
+    };
+    launch_ie_ij_nlev<num_lev_pack>(f);
+  }
+  for (int s = 0; s < nsubstep; ++s) {
+    const Real a = Real(s)/nsubstep, b = Real(s+1)/nsubstep;
+    const auto f = KOKKOS_LAMBDA (const int idx) {
       int ie, i, j, lev;
       idx_ie_ij_nlev<num_lev_pack>(idx, ie, i, j, lev);
-      omega(ie,i,j,lev) *= spheremp(ie,i,j);
+      for (int d = 0; d < 2; ++d) {
+        vstar(ie,d,i,j,lev) = (1 - a)*v0(ie,d,i,j,lev) + a*v(ie,np1,d,i,j,lev);
+        v1(ie,d,i,j,lev) = (1 - b)*v0(ie,d,i,j,lev) + b*v(ie,np1,d,i,j,lev);
+      }
+      dp(ie,i,j,lev) = (1 - a)*dp0(ie,i,j,lev) + a*dp1(ie,i,j,lev);
+      dp3d(ie,np1,i,j,lev) = (1 - b)*dp0(ie,i,j,lev) + b*dp1(ie,i,j,lev);
     };
-    launch_ie_ij_nlev<num_lev_pack>(f2);
-    m_qdp_dss_be[tl.np1_qdp]->exchange(m_geometry.m_rspheremp);
+    launch_ie_ij_nlev<num_lev_pack>(f);
+    if (s > 0) {
+      const auto g = KOKKOS_LAMBDA (const int idx) {
+        int ie, q, i, j, lev;
+        idx_ie_q_ij_nlev<num_lev_pack>(qsize, idx, ie, q, i, j, lev);
+        qdp(ie,n0_qdp,q,i,j,lev) = qdp(ie,np1_qdp,q,i,j,lev);
+      };
+      launch_ie_q_ij_nlev<num_lev_pack>(qsize, g);
+    }
     Kokkos::fence();
-    GPTLstop("compose_dss_q");
+    calc_trajectory(np1, dt/nsubstep, true);
+    advance_sl(tl, dt/nsubstep, s == nsubstep-1);
   }
-  
-  if (m_data.cdr_check) {
-    GPTLstart("compose_cedr_check");
-    homme::compose::property_preserve_check();
+  {
+    const auto f = KOKKOS_LAMBDA (const int idx) {
+      int ie, i, j, lev;
+      idx_ie_ij_nlev<num_lev_pack>(idx, ie, i, j, lev);
+      dp(ie,i,j,lev) = dp0(ie,i,j,lev);
+      dp3d(ie,np1,i,j,lev) = dp1(ie,i,j,lev);
+    };
+    launch_ie_ij_nlev<num_lev_pack>(f);
     Kokkos::fence();
-    GPTLstop("compose_cedr_check");
   }
-  
-  GPTLstop("compose_transport");
+  GPTLstop("compose_substeps");
 }
 
 } // namespace Homme
@@ -183,6 +183,118 @@ void ComposeTransportImpl::test_2d (const bool bfb, const int nstep, std::vector
   finish(*this, Context::singleton().get<Comm>(), tl.n0_qdp, tl.np1, eval);
 }
 
+// ICs, the t = 0 wind, m_dp = dp3d(np1) = 1, and a marker in vn0. With a
+// steady wind and dp, the fields run_substeps interpolates to substep
+// boundaries are exactly the plain-step ones.
+static void init_substep_test (const ComposeTransportImpl& cti, const TimeLevel& tl) {
+  fill_ics(cti, tl.n0_qdp, tl.np1);
+  fill_v(cti, 0, tl.np1, true);
+  const auto dp = cti.m_derived.m_dp;
+  const auto vn0 = cti.m_derived.m_vn0;
+  const auto f = KOKKOS_LAMBDA (const int idx) {
+    int ie, i, j, lev;
+    CTI::idx_ie_ij_nlev<CTI::num_lev_pack>(idx, ie, i, j, lev);
+    dp(ie,i,j,lev) = 1;
+    for (int d = 0; d < 2; ++d) vn0(ie,d,i,j,lev) = ie + d + 1;
+  };
+  cti.launch_ie_ij_nlev<CTI::num_lev_pack>(f);
+  Kokkos::fence();
+}
+
+static int check_vn0_marker (const ComposeTransportImpl& cti) {
+  const auto vn0 = CTI::cmvdc(cti.m_derived.m_vn0);
+  int nerr = 0;
+  for (int ie = 0; ie < cti.m_data.nelemd; ++ie)
+    for (int d = 0; d < 2; ++d)
+      for (int i = 0; i < cti.np; ++i)
+        for (int j = 0; j < cti.np; ++j)
+          for (int p = 0; p < CTI::num_lev_pack; ++p)
+            for (int s = 0; s < cti.packn; ++s)
+              if (vn0(ie,d,i,j,p)[s] != ie + d + 1) ++nerr;
+  return nerr;
+}
+
+int ComposeTransportImpl::test_substeps (const int nstep, const int nsubstep) {
+  // Substepping is not supported with independent time steps.
+  if (m_data.independent_time_steps) return 0;
+
+  SimulationParams& params = Context::singleton().get<SimulationParams>();
+  params.qsplit = 1;
+  TimeLevel& tl = Context::singleton().get<TimeLevel>();
+  const Real twelve_days = 3600 * 24 * 12, dt = twelve_days/nstep;
+  const auto nsubstep_max = m_data.nsubstep_max;
+  const auto courant_max = m_data.courant_max;
+  m_data.nsubstep_max = std::max(nsubstep_max, nsubstep);
+  init_substeps();
+  int nerr = 0;
+
+  { // The max Courant number is positive and ~linear in dt for a short step.
+    tl.nstep = 0;
+    tl.update_tracers_levels(params.qsplit);
+    init_substep_test(*this, tl);
+    Real courant[2];
+    for (int k = 0; k < 2; ++k) {
+      cp_v_to_vstar(*this, tl.np1);
+      Kokkos::fence();
+      calc_trajectory(tl.np1, k == 0 ? dt : dt/2);
+      courant[k] = calc_max_courant_number();
+    }
+    if ( ! (courant[1] > 0) || std::abs(courant[0]/(2*courant[1]) - 1) > 0.1) {
+      ++nerr;
+      if (Context::singleton().get<Comm>().root())
+        printf("test_substeps: courant %1.3e for dt, %1.3e for dt/2\n",
+               courant[0], courant[1]);
+    }
+  }
+
+  // nstep*nsubstep plain steps of length dt/nsubstep, then nstep steps of
+  // length dt, each forced to take nsubstep substeps.
+  using QdpH = decltype(cmvdc(m_tracers.qdp));
+  QdpH qdp[2];
+  int n0_qdp[2];
+  for (int k = 0; k < 2; ++k) {
+    const int nsub = k == 0 ? 1 : nsubstep, n = k == 0 ? nstep*nsubstep : nstep;
+    m_data.nsubstep_max = nsub;
+    // Any Courant number exceeds this, so run takes nsubstep_max substeps.
+    m_data.courant_max = 1e-10;
+    tl.nstep = 0;
+    tl.update_tracers_levels(params.qsplit);
+    init_substep_test(*this, tl);
+    for (int i = 0; i < n; ++i) {
+      cp_v_to_vstar(*this, tl.np1);
+      Kokkos::fence();
+      run(tl, k == 0 ? dt/nsubstep : dt);
+      Kokkos::fence();
+      if (m_data.nsubstep != nsub) ++nerr;
+      tl.nstep += params.qsplit;
+      tl.update_tracers_levels(params.qsplit);
+    }
+    qdp[k] = cmvdc(m_tracers.qdp);
+    n0_qdp[k] = tl.n0_qdp;
+    nerr += check_vn0_marker(*this);
+  }
+  m_data.nsubstep_max = nsubstep_max;
+  m_data.courant_max = courant_max;
+
+  Real num = 0, den = 0;
+  for (int ie = 0; ie < m_data.nelemd; ++ie)
+    for (int q = 0; q < m_data.qsize; ++q)
+      for (int i = 0; i < np; ++i)
+        for (int j = 0; j < np; ++j)
+          for (int k = 0; k < num_phys_lev; ++k) {
+            const int p = k / packn, s = k % packn;
+            const Real a = qdp[0](ie,n0_qdp[0],q,i,j,p)[s], b = qdp[1](ie,n0_qdp[1],q,i,j,p)[s];
+            num = std::max(num, std::abs(a - b));
+            den = std::max(den, std::abs(a));
+          }
+  // BFB in principle; allow for nondeterministic reductions on device.
+  if (num > 1e-12*den) {
+    ++nerr;
+    printf("test_substeps: substepped qdp max diff %1.3e, max |qdp| %1.3e\n", num, den);
+  }
+  return nerr;
+}
+
 } // namespace Homme
 
 #endif // HOMME_ENABLE_COMPOSE
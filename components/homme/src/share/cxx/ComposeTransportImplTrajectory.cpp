@@ -345,7 +345,8 @@ KOKKOS_FUNCTION static void calc_vertically_lagrangian_levels (
           = p1 - dt/2 (v(p1,t0) + v(p1,t1) - dt grad v(p1,t0) v(p1,t1)) + O(dt^3)
    In the code, v(p1,t0) = vstar, v(p1,t1) is vn0.
  */
-void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
+void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt,
+                                            const bool substep) {
   GPTLstart("compose_calc_trajectory");
   const auto sphere_ops = m_sphere_ops;
   const auto geo = m_geometry;
@@ -361,6 +362,7 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
     const auto m_v = m_state.m_v;
     const auto m_vn0 = m_derived.m_vn0;
     const auto independent_time_steps = m_data.independent_time_steps;
+    const auto m_v1 = m_data.v1;
     const Real dp_tol = m_data.dp_tol;
     const Real ps0 = m_hvcoord.ps0;
     const Real hybrid_ai0 = m_hvcoord.hybrid_ai0;
@@ -415,7 +417,8 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
     const auto calc_midpoint_velocity = KOKKOS_LAMBDA (const MT& team) {
       KernelVariables kv(team, tu_ne);
       const auto ie = kv.ie;
-      const auto vn0 = (independent_time_steps ?
+      const auto vn0 = (substep ? Homme::subview(m_v1, ie) :
+                        independent_time_steps ?
                         Homme::subview(m_vn0, ie) :
                         Homme::subview(m_v, ie, np1));
       const auto vstar = Homme::subview(m_vstar, ie);
@@ -488,6 +491,35 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
   GPTLstop("compose_calc_trajectory");
 }
 
+// Maximum over all departure points of the distance from the arrival point, in
+// units of the arrival element's width, sqrt(element area).
+Real ComposeTransportImpl::calc_max_courant_number () {
+  const auto m_spheremp = m_geometry.m_spheremp;
+  const auto m_sphere_cart = m_geometry.m_sphere_cart;
+  const auto scale_factor = m_geometry.m_scale_factor;
+  const auto m_dep_pts = m_data.dep_pts;
+  Real courant;
+  const auto f = KOKKOS_LAMBDA (const int idx, Real& cmax) {
+    int ie, lev, i, j;
+    idx_ie_physlev_ij(idx, ie, lev, i, j);
+    Real area = 0;
+    for (int ii = 0; ii < np; ++ii)
+      for (int jj = 0; jj < np; ++jj)
+        area += m_spheremp(ie,ii,jj);
+    Real d2 = 0;
+    for (int d = 0; d < 3; ++d)
+      d2 += square(m_dep_pts(ie,lev,i,j,d) - m_sphere_cart(ie,i,j,d));
+    const Real c = std::sqrt(d2)*scale_factor/std::sqrt(area);
+    if (c > cmax) cmax = c;
+  };
+  Kokkos::parallel_reduce(
+    Kokkos::RangePolicy<ExecSpace>(0, m_data.nelemd*np*np*num_phys_lev), f,
+    Kokkos::Max<Real>(courant));
+  const auto& comm = Context::singleton().get<Connectivity>().get_comm();
+  MPI_Allreduce(MPI_IN_PLACE, &courant, 1, MPI_DOUBLE, MPI_MAX, comm.mpi_comm());
+  return courant;
+}
+
 static int test_approx_derivative () {
   const Real a = 1.5, b = -0.7, c = 0.2;
   int nerr = 0;
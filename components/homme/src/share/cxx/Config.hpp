@@ -29,6 +29,10 @@
 # define HOMMEXX_MPI_ON_DEVICE 1
 #endif
 
+#ifndef HOMMEXX_MPI_SHARED_NODE
+# define HOMMEXX_MPI_SHARED_NODE 0
+#endif
+
 #include <Kokkos_Core.hpp>
 
 #ifdef HOMMEXX_ENABLE_GPU 
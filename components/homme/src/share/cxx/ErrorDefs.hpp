@@ -54,6 +54,8 @@ void runtime_abort(const std::string& message, int code = -1);
 static constexpr int err_unknown_option               = 11;
 static constexpr int err_not_implemented              = 12;
 static constexpr int err_invalid_options_combination  = 13;
+static constexpr int err_mpi_node_mismatch            = 14;
+static constexpr int err_host_isa_mismatch            = 15;
 static constexpr int err_negative_layer_thickness     = 101;
 static constexpr int err_bad_column_value             = 102;
 
@@ -60,7 +60,8 @@ struct SerialLimiter<HommexxGPU> {
 class EulerStepFunctorImpl {
   struct EulerStepData {
     EulerStepData ()
-      : qsize(-1), limiter_option(0), nu_p(0), nu_q(0), consthv(1)
+      : qsize(-1), limiter_option(0), nu_p(0), nu_q(0), consthv(1),
+        fuse_dss_pack(true)
     {}
 
     int   qsize;
@@ -78,6 +79,18 @@ class EulerStepFunctorImpl {
     DSSOption   DSSopt;
 
     bool consthv;
+
+    // Pack the limited qdp into the DSS send buffers from the tracer phase,
+    // rather than in a separate pass of the boundary exchange.
+    bool fuse_dss_pack;
+  };
+
+  // Targets of the fused DSS pack; valid during advect_and_limit only.
+  struct DssPack {
+    ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers;
+    ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon;
+    ExecViewUnmanaged<const int*> ucon_ptr;
+    ConnectionHelpers helpers;
   };
 
   struct Buffers {
@@ -99,6 +112,7 @@ class EulerStepFunctorImpl {
   deriv_type            m_deriv;
   HybridVCoord          m_hvcoord;
   EulerStepData         m_data;
+  DssPack               m_dss_pack;
   SphereOperators       m_sphere_ops;
 
   Kokkos::TeamPolicy<ExecSpace> m_tv_policy;
@@ -600,10 +614,28 @@ public:
     m_mm_be->exchange_min_max();
   }
 
+  BoundaryExchange& qdp_dss_be () const {
+    return *m_bes[3*m_data.np1_qdp + static_cast<int>(m_data.DSSopt)];
+  }
+
+  // Pack the limited qdp into the DSS send buffers from the tracer phase (the
+  // default), or leave it to the boundary exchange. Results are identical.
+  void set_fuse_dss_pack (const bool fuse) { m_data.fuse_dss_pack = fuse; }
+
+  // Point the tracer phase at the DSS send buffers, so that it packs the qsize
+  // qdp fields itself. The caller must have locked the buffers with a
+  // BoundaryExchange::PrepackedScope; exchange_qdp_dss_var then packs only the
+  // DSS variable.
+  void set_fused_dss_pack_targets (const BoundaryExchange& be) {
+    const auto connectivity = be.get_connectivity();
+    m_dss_pack.send_3d_buffers = be.get_send_3d_buffers();
+    m_dss_pack.ucon = connectivity->get_d_ucon();
+    m_dss_pack.ucon_ptr = connectivity->get_d_ucon_ptr();
+  }
+
   void exchange_qdp_dss_var () {
     GPTLstart("eus_bexch");
-    const int idx = 3*m_data.np1_qdp + static_cast<int>(m_data.DSSopt);
-    m_bes[idx]->exchange(m_geometry.m_rspheremp);
+    qdp_dss_be().exchange(m_geometry.m_rspheremp);
     GPTLstop("eus_bexch");
   }
 
@@ -652,6 +684,11 @@ public:
         minmax_and_biharmonic();
       }
     }
+    const bool fuse = m_data.fuse_dss_pack && m_data.qsize > 0;
+    // If anything throws before the exchange consumes the prepacked fields,
+    // the scope releases the send buffers.
+    BoundaryExchange::PrepackedScope prepacked(qdp_dss_be(), fuse ? m_data.qsize : 0);
+    if (fuse) set_fused_dss_pack_targets(qdp_dss_be());
     advect_and_limit();
     exchange_qdp_dss_var();
   }
@@ -784,6 +821,17 @@ private:
             qdp(igp, jgp, ilev) = spheremp(igp, jgp) * qtens(igp, jgp, ilev);
           });
       });
+    if (m_data.fuse_dss_pack) {
+      // qdp(np1) is still written, since the DSS unpack accumulates into it,
+      // but the boundary values go to the send buffers from registers rather
+      // than being re-read from qdp by the exchange.
+      BoundaryExchange::pack_3d_field(
+        kv.team, m_dss_pack.helpers, m_dss_pack.ucon, m_dss_pack.ucon_ptr,
+        m_dss_pack.send_3d_buffers, kv.ie, kv.iq,
+        [&] (const int igp, const int jgp, const int ilev) {
+          return spheremp(igp, jgp) * qtens(igp, jgp, ilev);
+        });
+    }
   }
 
   // Do all the setup and teardown associated with a limiter. Call a limiter
@@ -609,6 +609,23 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
   EquationOfState eos; eos.init(theta_hydrostatic_mode, hvcoord);
   ElementOps ops; ops.init(hvcoord);
   const auto tu_ne = m_tu_ne;
+  const auto qlim = m_tracers.qlim;
+  const auto tu_ne_qsize = m_tu_ne_qsize;
+
+  // The limiter bounds depend only on the FV tracers. Compute them first and
+  // start their halo exchange, so that the messages are in flight while the
+  // state and tracer remaps below run.
+  const auto fqe = KOKKOS_LAMBDA (const MT& team) {
+    KernelVariables kv(team, qsize, tu_ne_qsize);
+    const auto ie = kv.ie, iq = kv.iq;
+    calc_extrema(kv, nf2, nlevpk,
+                 [&] (int i, int k) { return q(ie,i,iq,k); },
+                 evus1(&qlim(ie,iq,0,0), nlevpk), evus1(&qlim(ie,iq,1,0), nlevpk));
+  };
+  Kokkos::fence();
+  parallel_for(m_tp_ne_qsize, fqe);
+  Kokkos::fence();
+  m_extrema_be->pack_and_send_min_max();
 
   const auto fe = KOKKOS_LAMBDA (const MT& team) {
     KernelVariables kv(team, tu_ne);
@@ -702,8 +719,6 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
   const auto dp_g = m_state.m_dp3d;
   const auto q_g = m_tracers.Q;
   const auto fq = m_tracers.fq;
-  const auto qlim = m_tracers.qlim;
-  const auto tu_ne_qsize = m_tu_ne_qsize;
 
   const auto feq = KOKKOS_LAMBDA (const MT& team) {
     KernelVariables kv(team, qsize, tu_ne_qsize);
@@ -722,13 +737,6 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
     const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
 
     {
-      // Get limiter bounds.
-      const evus2 qf_ie(&r2w(1,0,0,0), nf2, nlevpk);
-      loop_ik(ttrf, tvr, [&] (int i, int k) { qf_ie(i,k) = q(ie,i,iq,k); });
-      kv.team_barrier();
-      calc_extrema(kv, nf2, nlevpk, qf_ie,
-                   evus1(&qlim(ie,iq,0,0), nlevpk), evus1(&qlim(ie,iq,1,0), nlevpk));
-      kv.team_barrier();
       // FV Q_ten
       //   GLL Q0 -> FV Q0
       const evus2 dqf_ie(&r2w(0,0,0,0), nf2, nlevpk);
@@ -740,7 +748,7 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
         0, evus3(dqf_ie.data(), nf2, 1, nlevpk));
       kv.team_barrier();
       //   FV Q_ten = FV Q1 - FV Q0
-      loop_ik(ttrf, tvr, [&] (int i, int k) { dqf_ie(i,k) = qf_ie(i,k) - dqf_ie(i,k); });
+      loop_ik(ttrf, tvr, [&] (int i, int k) { dqf_ie(i,k) = q(ie,i,iq,k) - dqf_ie(i,k); });
       kv.team_barrier();
       // GLL Q_ten
       const evus_np2_nlev dqg_ie(rw2.data());
@@ -755,8 +763,8 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
   Kokkos::fence();
   parallel_for(m_tp_ne_qsize, feq);
 
-  // Halo exchange extrema data.
-  m_extrema_be->exchange_min_max();
+  // Finish the halo exchange of the extrema data.
+  m_extrema_be->recv_and_unpack_min_max();
 
   const auto geq = KOKKOS_LAMBDA (const MT& team) {
     KernelVariables kv(team, qsize, tu_ne_qsize);
@@ -790,6 +798,16 @@ void GllFvRemapImpl::run_fv_phys_to_dyn_dss () {
   const auto fq = m_tracers.fq;
   const auto fm = m_forcing.m_fm;
   const auto ft = m_forcing.m_ft;
+  // All the DSS fields are produced by the kernel below, so it also packs them
+  // into the send buffers, and the exchange does only the communication and
+  // unpack. The scope releases the send buffers if anything throws before the
+  // exchange consumes the prepacked fields.
+  BoundaryExchange::PrepackedScope prepacked(*m_dss_be, n_dss_fld);
+  const auto send_buffers = m_dss_be->get_send_3d_buffers();
+  const auto connectivity = m_dss_be->get_connectivity();
+  const auto ucon = connectivity->get_d_ucon();
+  const auto ucon_ptr = connectivity->get_d_ucon_ptr();
+  HOMMEXX_STATIC const ConnectionHelpers helpers;
   const auto f = KOKKOS_LAMBDA (const MT& team) {
     const int ie  = team.league_rank() / n_dss_fld;
     const int idx = team.league_rank() % n_dss_fld;
@@ -801,6 +819,10 @@ void GllFvRemapImpl::run_fv_phys_to_dyn_dss () {
                       /**/               &fm(ie,idx-qsize,0,0,0)),
                      np2, nlevpk);
     loop_ik(ttrg, tvr, [&] (int i, int k) { f_ie(i,k) *= s(i); });
+    team.team_barrier();
+    BoundaryExchange::pack_3d_field(
+      team, helpers, ucon, ucon_ptr, send_buffers, ie, idx,
+      [&] (int i, int j, int k) { return f_ie(i*NP+j,k); });
   };
   Kokkos::fence();
   Kokkos::parallel_for(m_tp_ne_dss, f);
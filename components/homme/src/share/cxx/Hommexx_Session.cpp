@@ -7,6 +7,8 @@
 #include "Config.hpp"
 #include "Hommexx_Session.hpp"
 #include "ExecSpaceDefs.hpp"
+#include "ErrorDefs.hpp"
+#include "HostIsaCheck.hpp"
 #include "profiling.hpp"
 #include "mpi/Comm.hpp"
 
@@ -38,6 +40,20 @@ std::string active_avx_string () {
   return s;
 }
 
+extern const int hommexx_build_isa = 0
+#if defined __AVX512F__
+  | isa_avx512f
+#endif
+#if defined __AVX2__
+  | isa_avx2
+#endif
+#if defined __AVX__
+  | isa_avx
+#endif
+  ;
+
+extern const int host_isa_mismatch_code = Errors::err_host_isa_mismatch;
+
 void print_homme_config_settings () {
   // Print configure-time settings.
 #ifdef HOMMEXX_SHA1
@@ -46,7 +62,9 @@ void print_homme_config_settings () {
     std::cout << "HOMMEXX VECTOR_SIZE: " << VECTOR_SIZE << "\n";
     std::cout << "HOMMEXX vector tag: " << Scalar::label() << "\n";
     std::cout << "HOMMEXX active AVX set:" << active_avx_string() << "\n";
+    std::cout << "HOMMEXX host AVX set:" << isa_string(host_isa()) << "\n";
     std::cout << "HOMMEXX MPI_ON_DEVICE: " << HOMMEXX_MPI_ON_DEVICE << "\n";
+    std::cout << "HOMMEXX MPI_SHARED_NODE: " << HOMMEXX_MPI_SHARED_NODE << "\n";
 #ifdef HOMMEXX_CUDA_SHARE_BUFFER
     std::cout << "HOMMEXX CUDA_SHARE_BUFFER: on\n";
 #else
@@ -86,6 +104,7 @@ void initialize_hommexx_session ()
     // Note: at this point, the Comm *should* already be created.
     const auto& comm = Context::singleton().get<Comm>();
     if (comm.root()) {
+      note_wider_host_isa();
       ExecSpace().print_configuration(std::cout, true);
       print_homme_config_settings ();
     }
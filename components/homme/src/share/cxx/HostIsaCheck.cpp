@@ -0,0 +1,71 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+// This file is compiled without AVX (see homme_host_isa_check_flags in
+// HommeMacros.cmake), so it can run on any x86 host. Do not include Kokkos or
+// vector headers here.
+
+#include "HostIsaCheck.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#if (defined __GNUC__ || defined __clang__) && (defined __x86_64__ || defined __i386__)
+# define HOMMEXX_HAVE_CPU_SUPPORTS
+#endif
+
+namespace Homme
+{
+
+int host_isa () {
+  int isa = 0;
+#ifdef HOMMEXX_HAVE_CPU_SUPPORTS
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx"))     isa |= isa_avx;
+  if (__builtin_cpu_supports("avx2"))    isa |= isa_avx2;
+  if (__builtin_cpu_supports("avx512f")) isa |= isa_avx512f;
+#endif
+  return isa;
+}
+
+std::string isa_string (const int isa) {
+  std::string s;
+  if (isa & isa_avx512f) s += " - AVX512F";
+  if (isa & isa_avx2)    s += " - AVX2";
+  if (isa & isa_avx)     s += " - AVX";
+  return s;
+}
+
+void note_wider_host_isa () {
+  const int wider = host_isa() & ~hommexx_build_isa;
+  if (wider & isa_avx512f) {
+    std::cout << "HOMMEXX note: host supports AVX512F, but this build does not use it.\n";
+  } else if (wider & isa_avx2) {
+    std::cout << "HOMMEXX note: host supports AVX2, but this build does not use it.\n";
+  }
+}
+
+#ifdef HOMMEXX_HAVE_CPU_SUPPORTS
+// VECTOR_SIZE and the AVX set are fixed at compile time, and on a cluster
+// with mixed node types a binary can end up on a host it was not built for.
+// Check before main and before default-priority C++ constructors, so the run
+// stops with a clear message rather than an illegal instruction. MPI is not
+// up yet, so report on stderr and exit with the error code directly.
+__attribute__((constructor(101)))
+static void check_host_isa_at_load () {
+  const int missing = hommexx_build_isa & ~host_isa();
+  if (missing == 0) return;
+  std::fprintf(stderr,
+               "HOMMEXX was compiled for instruction sets this host does not support:%s.\n"
+               "Use a build matching this node type.\nExiting...\n",
+               isa_string(missing).c_str());
+  std::fflush(stderr);
+  std::_Exit(host_isa_mismatch_code);
+}
+#endif
+
+} // namespace Homme
@@ -0,0 +1,45 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#ifndef HOMMEXX_HOST_ISA_CHECK_HPP
+#define HOMMEXX_HOST_ISA_CHECK_HPP
+
+#include <string>
+
+namespace Homme
+{
+
+// Bits of the AVX sets a binary can be compiled for or a host can support.
+enum : int {
+  isa_avx     = 1,
+  isa_avx2    = 2,
+  isa_avx512f = 4
+};
+
+// AVX sets the vectorized HOMMEXX code was compiled for. Defined in
+// Hommexx_Session.cpp, which is built with the regular flags, and constant
+// initialized, so it can be read before any constructor runs.
+extern const int hommexx_build_isa;
+
+// Errors::err_host_isa_mismatch, for HostIsaCheck.cpp, which must not include
+// ErrorDefs.hpp since that pulls in Kokkos.
+extern const int host_isa_mismatch_code;
+
+// AVX sets supported by the host we are running on.
+int host_isa ();
+
+// " - AVX512F - AVX2 - AVX" style listing of the sets in isa.
+std::string isa_string (const int isa);
+
+// HostIsaCheck.cpp is compiled without AVX, and aborts at load time, before
+// any vectorized code (static initializers included) runs, if the host lacks
+// a set in hommexx_build_isa. This is called at session init, on the root
+// rank only, to note a host that supports a wider set than the build uses.
+void note_wider_host_isa ();
+
+} // namespace Homme
+
+#endif // HOMMEXX_HOST_ISA_CHECK_HPP
@@ -201,6 +201,20 @@ struct PpmVertRemap : public VertRemapAlg {
   void compute_remap_phase(KernelVariables &kv,
                            ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]> remap_var)
       const {
+    compute_remap_phase(kv, 1, [&] (const int) { return remap_var; });
+  }
+
+  // Remap nfields fields of element kv.ie in a single team. get_field(i),
+  // 0 <= i < nfields, returns the i-th field as a view of type
+  // ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]>. The fields of a column are
+  // remapped back to back by the same thread, so the column's grid data from
+  // compute_grids_phase (dpo, ppmdx, kid, z2) are read from memory once and
+  // reused from cache for the rest of the batch, and the per-team buffers
+  // stay hot between fields.
+  template <typename FieldGetter>
+  KOKKOS_INLINE_FUNCTION
+  void compute_remap_phase(KernelVariables &kv, const int nfields,
+                           const FieldGetter& get_field) const {
     // From here, we loop over tracers for only those portions which depend on
     // tracer data, which includes PPM limiting and mass accumulation
     // More parallelism than we need here, maybe break it up?
@@ -209,48 +223,51 @@ struct PpmVertRemap : public VertRemapAlg {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
 
-      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
-                           [&](const int k) {
-        const int ilevel = k / VECTOR_SIZE;
-        const int ivector = k % VECTOR_SIZE;
-        m_ao(kv.team_idx, igp, jgp, k + _ppm_consts::INITIAL_PADDING) =
-            remap_var(igp, jgp, ilevel)[ivector] /
-            m_dpo(kv.ie, igp, jgp, k + _ppm_consts::INITIAL_PADDING);
-      });
+      const auto dpo   = Homme::subview(m_dpo, kv.ie, igp, jgp);
+      const auto ppmdx = Homme::subview(m_ppmdx, kv.ie, igp, jgp);
+      const auto kid   = Homme::subview(m_kid, kv.ie, igp, jgp);
+      const auto z2    = Homme::subview(m_z2, kv.ie, igp, jgp);
+      const auto ao     = Homme::subview(m_ao, kv.team_idx, igp, jgp);
+      const auto mass_o = Homme::subview(m_mass_o, kv.team_idx, igp, jgp);
+      const auto dma    = Homme::subview(m_dma, kv.team_idx, igp, jgp);
+      const auto ai     = Homme::subview(m_ai, kv.team_idx, igp, jgp);
+      const auto coeffs = Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp);
+
+      for (int f = 0; f < nfields; ++f) {
+        const ExecViewUnmanaged<Scalar[NUM_LEV]> remap_var =
+            Homme::subview(get_field(f), igp, jgp);
+
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
+                             [&](const int k) {
+          const int ilevel = k / VECTOR_SIZE;
+          const int ivector = k % VECTOR_SIZE;
+          ao(k + _ppm_consts::INITIAL_PADDING) =
+              remap_var(ilevel)[ivector] /
+              dpo(k + _ppm_consts::INITIAL_PADDING);
+        });
 
-      boundaries::fill_cell_means_gs(kv, Homme::subview(m_dpo, kv.ie, igp, jgp),
-                                     Homme::subview(m_ao, kv.team_idx, igp, jgp));
+        boundaries::fill_cell_means_gs(kv, dpo, ao);
+
+        Dispatch<ExecSpace>::parallel_scan(
+            kv.team, NUM_PHYSICAL_LEV,
+            [=](const int &k, Real &accumulator, const bool last) {
+              // Accumulate the old mass up to old grid cell interface locations
+              // to simplify integration during remapping. Also, divide out the
+              // grid spacing so we're working with actual tracer values and can
+              // conserve mass.
+              const int ilevel = k / VECTOR_SIZE;
+              const int ivector = k % VECTOR_SIZE;
+              accumulator += remap_var(ilevel)[ivector];
+              if (last) {
+                mass_o(k + 1) = accumulator;
+              }
+        });
 
-      Dispatch<ExecSpace>::parallel_scan(
-          kv.team, NUM_PHYSICAL_LEV,
-          [=](const int &k, Real &accumulator, const bool last) {
-            // Accumulate the old mass up to old grid cell interface locations
-            // to simplify integration during remapping. Also, divide out the
-            // grid spacing so we're working with actual tracer values and can
-            // conserve mass.
-            const int ilevel = k / VECTOR_SIZE;
-            const int ivector = k % VECTOR_SIZE;
-            accumulator += remap_var(igp, jgp, ilevel)[ivector];
-            if (last) {
-              m_mass_o(kv.team_idx, igp, jgp, k + 1) = accumulator;
-            }
-      });
+        // Computes a monotonic and conservative PPM reconstruction
+        compute_ppm(kv, ao, ppmdx, dma, ai, coeffs);
 
-      // Computes a monotonic and conservative PPM reconstruction
-      compute_ppm(kv,
-                  Homme::subview(m_ao, kv.team_idx, igp, jgp),
-                  Homme::subview(m_ppmdx, kv.ie, igp, jgp),
-                  Homme::subview(m_dma, kv.team_idx, igp, jgp),
-                  Homme::subview(m_ai, kv.team_idx, igp, jgp),
-                  Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp));
-
-      compute_remap(kv,
-                    Homme::subview(m_kid, kv.ie, igp, jgp),
-                    Homme::subview(m_z2, kv.ie, igp, jgp),
-                    Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp),
-                    Homme::subview(m_mass_o, kv.team_idx, igp, jgp),
-                    Homme::subview(m_dpo, kv.ie, igp, jgp),
-                    Homme::subview(remap_var, igp, jgp));
+        compute_remap(kv, kid, z2, coeffs, mass_o, dpo, remap_var);
+      }
     }); // End team thread range
     kv.team_barrier();
   }
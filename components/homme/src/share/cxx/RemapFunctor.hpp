@@ -292,6 +292,11 @@ struct RemapFunctor : public Remapper {
 
   TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_nsr, m_tu_ne_ntr;
 
+  // Number of fields remapped by one team in the remap phase of run_remap.
+  // Fields in a batch share the element's grid data computed in the grids
+  // phase. remap1 sizes its batches from its own field count.
+  int m_fields_per_team;
+
   explicit
   RemapFunctor (const int qsize,
                 const Elements& elements,
@@ -312,6 +317,7 @@ struct RemapFunctor : public Remapper {
    , m_tu_ne(remap_team_policy<ComputeThicknessTag>(m_state.num_elems()))
    , m_tu_ne_nsr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * m_fields_provider.num_states_remap()))
    , m_tu_ne_ntr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * num_to_remap()))
+   , m_fields_per_team(fields_per_team(m_state.num_elems(), num_to_remap()))
   {
     // Members used for sanity checks
     valid_layer_thickness = decltype(valid_layer_thickness)("Check for whether the surface thicknesses are positive",elements.num_elems());
@@ -345,6 +351,24 @@ struct RemapFunctor : public Remapper {
   KOKKOS_INLINE_FUNCTION
   int num_to_remap() const { return m_fields_provider.num_states_remap() + m_data.qsize; }
 
+  // On GPU, one field per team exposes the most parallelism. On CPU, the
+  // number of teams only needs to cover the available concurrency, so give
+  // each team as many fields as possible to amortize the reads of the grid
+  // data over the batch. num_fields must be the number of fields actually
+  // remapped, not the capacity, or small remaps get too few teams.
+  static int fields_per_team (const int num_elems, const int num_fields) {
+    if (OnGpu<ExecSpace>::value || num_elems <= 0 || num_fields <= 1) return 1;
+    const int concurrency = ExecSpace::concurrency();
+    const int nbatch = std::min(num_fields, (concurrency + num_elems - 1) / num_elems);
+    // Round down so that num_batches(num_fields, result) >= nbatch.
+    return num_fields / nbatch;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static int num_batches (const int num_fields, const int fields_per_batch) {
+    return (num_fields + fields_per_batch - 1) / fields_per_batch;
+  }
+
   KOKKOS_INLINE_FUNCTION
   ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]>
   get_remap_val(const KernelVariables &kv, int var) const {
@@ -414,11 +438,15 @@ struct RemapFunctor : public Remapper {
   void operator()(ComputeRemapTag, const TeamMember &team) const {
     KernelVariables kv(team, m_tu_ne_ntr);
     assert(num_to_remap() != 0);
-    const int var = kv.ie % num_to_remap();
-    kv.ie /= num_to_remap();
+    const int nbatch = num_batches(num_to_remap(), m_fields_per_team);
+    const int var0 = (kv.ie % nbatch) * m_fields_per_team;
+    kv.ie /= nbatch;
     assert(kv.ie < m_state.num_elems());
 
-    this->m_remap.compute_remap_phase(kv, get_remap_val(kv, var));
+    const int nvar = num_to_remap() - var0 < m_fields_per_team ?
+                     num_to_remap() - var0 : m_fields_per_team;
+    this->m_remap.compute_remap_phase(
+      kv, nvar, [&] (const int i) { return get_remap_val(kv, var0 + i); });
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -474,7 +502,8 @@ struct RemapFunctor : public Remapper {
       run_functor<ComputeGridsTag>("Remap Compute Grids Functor",
                                    m_state.num_elems());
       run_functor<ComputeRemapTag>("Remap Compute Remap Functor",
-                                   m_state.num_elems() * num_to_remap());
+                                   m_state.num_elems() *
+                                   num_batches(num_to_remap(), m_fields_per_team));
       if (nonzero_rsplit) {
         run_functor<ComputeIntrinsicsTag>("Remap Rescale States Functor",
                                           m_state.num_elems() * m_fields_provider.num_states_remap());
@@ -504,12 +533,15 @@ struct RemapFunctor : public Remapper {
     };
     Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne), g);
     const auto tu_ne_ntr = m_tu_ne_ntr;
+    const int nf = fields_per_team(ne, nv), nb = num_batches(nv, nf);
     const auto r = KOKKOS_LAMBDA (const TeamMember& team) {
-      KernelVariables kv(team, nv, tu_ne_ntr);
-      remap.compute_remap_phase(kv, Kokkos::subview(v, kv.ie, kv.iq, ALL(), ALL(), ALL()));
+      KernelVariables kv(team, nb, tu_ne_ntr);
+      const int iv0 = kv.iq*nf, nvb = nv - iv0 < nf ? nv - iv0 : nf;
+      remap.compute_remap_phase(
+        kv, nvb, [&] (const int i) { return Kokkos::subview(v, kv.ie, iv0 + i, ALL(), ALL(), ALL()); });
     };
     Kokkos::fence();
-    Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne*nv), r);
+    Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne*nb), r);
   }
 
   void remap1 (
@@ -530,12 +562,15 @@ struct RemapFunctor : public Remapper {
     };
     Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne), g);
     const auto tu_ne_ntr = m_tu_ne_ntr;
+    const int nf = fields_per_team(ne, nv), nb = num_batches(nv, nf);
     const auto r = KOKKOS_LAMBDA (const TeamMember& team) {
-      KernelVariables kv(team, nv, tu_ne_ntr);
-      remap.compute_remap_phase(kv, Kokkos::subview(v, kv.ie, n_v, kv.iq, ALL(), ALL(), ALL()));
+      KernelVariables kv(team, nb, tu_ne_ntr);
+      const int iv0 = kv.iq*nf, nvb = nv - iv0 < nf ? nv - iv0 : nf;
+      remap.compute_remap_phase(
+        kv, nvb, [&] (const int i) { return Kokkos::subview(v, kv.ie, n_v, iv0 + i, ALL(), ALL(), ALL()); });
     };
     Kokkos::fence();
-    Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne*nv), r);
+    Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne*nb), r);
   }
 
   int requested_buffer_size () const override {
@@ -69,6 +69,9 @@ struct SimulationParams
   // to >0 for diagnostics.
   int       internal_diagnostics_level = 0;
 
+  // Reuse the DIRK Newton Jacobian factorization across iterations and stages.
+  bool      dirk_modified_newton = false;
+
   // Use this member to check whether the struct has been initialized
   bool      params_set = false;
 };
@@ -113,6 +116,7 @@ inline void SimulationParams::print (std::ostream& out) {
   out << "   dp3d_thresh: " << dp3d_thresh << "\n";
   out << "   vtheta_thresh: " << vtheta_thresh << "\n";
   out << "   internal_diagnostics_level: " << internal_diagnostics_level << "\n";
+  out << "   dirk_modified_newton: " << (dirk_modified_newton ? "yes" : "no") << "\n";
   out << "\n**********************************************************\n";
 }
 
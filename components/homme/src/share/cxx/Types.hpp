@@ -173,6 +173,8 @@ namespace Remap {
 // previously computed in compute_grids_phase.
 // It is also expected to have a large amount of parallelism, specifically
 // qsize * num_elems
+// An overload compute_remap_phase(kv, nfields, get_field) remaps a batch of
+// fields of one element in a single team, reusing the grid quantities.
 struct VertRemapAlg {};
 } // namespace Remap
 
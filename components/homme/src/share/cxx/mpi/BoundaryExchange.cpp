@@ -12,6 +12,8 @@
 
 #include "utilities/VectorUtils.hpp"
 
+#include <algorithm>
+
 #ifndef HOMME_BE_NO_HASHER
 // It's convenient and clean to use boundary exchanges as the place to hash
 // state. However, this interferes with the BoundaryExchange unit test's
@@ -42,6 +44,7 @@ BoundaryExchange::BoundaryExchange()
   m_num_2d_fields = 0;
   m_num_3d_fields = 0;
   m_num_3d_int_fields = 0;
+  m_num_prepacked_3d_fields = 0;
 
   m_connectivity    = std::shared_ptr<Connectivity>();
   m_buffers_manager = std::shared_ptr<MpiBuffersManager>();
@@ -392,24 +395,28 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
       const int num_elems, const int num_3d_fields,
-      ExecViewManaged<int*>* nlev_packs_ = nullptr) {
+      ExecViewManaged<int*>* nlev_packs_ = nullptr,
+      const int ifield_beg = 0) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
   ExecViewUnmanaged<const int*> nlev_packs;
   if (partial_column) nlev_packs = *nlev_packs_;
+  // Fields [0, ifield_beg) were packed by the caller.
+  const int nfields = num_3d_fields - ifield_beg;
+  if (nfields <= 0) return;
   if (OnGpu<ExecSpace>::value) {
     const ConnectionHelpers helpers;
     const int nconn = ucon.extent_int(0);
     Kokkos::parallel_for(
-      Kokkos::RangePolicy<ExecSpace>(0, num_3d_fields*nconn*NUM_LEV_PACKS),
+      Kokkos::RangePolicy<ExecSpace>(0, nfields*nconn*NUM_LEV_PACKS),
       KOKKOS_LAMBDA(const int it) {
         const int ilev = it % NUM_LEV_PACKS;
-        const int ifield = (it / NUM_LEV_PACKS) % num_3d_fields;
+        const int ifield = ifield_beg + (it / NUM_LEV_PACKS) % nfields;
         if (partial_column) { // compile out if !partial_column
           if (ilev >= nlev_packs(ifield))
             return;
         }
-        const int iconn = it / (num_3d_fields*NUM_LEV_PACKS);
+        const int iconn = it / (nfields*NUM_LEV_PACKS);
         const auto& info = ucon(iconn);
         const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                   info.sharing_local_remote_iconn :
@@ -421,7 +428,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
           sb(k, ilev) = f3(pts[k].ip, pts[k].jp, ilev);
       });
   } else {
-    const auto num_parallel_iterations = num_elems*num_3d_fields;
+    const auto num_parallel_iterations = num_elems*nfields;
     ThreadPreferences tp;
     tp.max_threads_usable = NP;
     tp.max_vectors_usable = NUM_LEV_PACKS;
@@ -433,9 +440,9 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
     HOMMEXX_STATIC const ConnectionHelpers helpers;
     Kokkos::parallel_for(policy,
       KOKKOS_LAMBDA(const TeamMember& team) {
-        Homme::KernelVariables kv(team, num_3d_fields);
+        Homme::KernelVariables kv(team, nfields);
         const int ie = kv.ie;
-        const int ifield = kv.iq;
+        const int ifield = ifield_beg + kv.iq;
         const auto tvr = Kokkos::ThreadVectorRange(
           kv.team, partial_column ? nlev_packs(ifield) : NUM_LEV_PACKS);
         const int iconn_end = ucon_ptr(ie+1);
@@ -461,6 +468,32 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
   }
 }
 
+void BoundaryExchange::begin_prepacked (const int num_3d_fields)
+{
+  assert (m_registration_completed);
+  assert (m_exchange_type==MPI_EXCHANGE);
+  assert (num_3d_fields > 0 && num_3d_fields <= m_num_3d_fields);
+  // The caller's kernel writes NUM_LEV packs per field.
+  assert (m_3d_nlev_pack_d.size() == 0);
+
+  // Build the views first, since locking the buffers prevents the buffers
+  // manager from reallocating them.
+  if (!m_buffer_views_and_requests_built) {
+    build_buffer_views_and_requests();
+  }
+
+  assert (!m_buffers_manager->are_buffers_busy());
+  m_buffers_manager->lock_buffers();
+  m_num_prepacked_3d_fields = num_3d_fields;
+}
+
+void BoundaryExchange::cancel_prepacked ()
+{
+  if (m_num_prepacked_3d_fields == 0) return;
+  m_num_prepacked_3d_fields = 0;
+  m_buffers_manager->unlock_buffers();
+}
+
 void BoundaryExchange::pack_and_send ()
 {
   tstart("be pack_and_send");
@@ -476,14 +509,18 @@ void BoundaryExchange::pack_and_send ()
     return;
   }
 
-  // Check that buffers are not locked by someone else, then lock them
-  assert (!m_buffers_manager->are_buffers_busy());
-  m_buffers_manager->lock_buffers();
+  // Check that buffers are not locked by someone else, then lock them. If the
+  // leading fields were prepacked, begin_prepacked already holds the lock.
+  if (m_num_prepacked_3d_fields == 0) {
+    assert (!m_buffers_manager->are_buffers_busy());
+    m_buffers_manager->lock_buffers();
+  }
 
   // If this is the first time we call this method, or if the MpiBuffersManager has performed a reallocation
   // since the last time this method was called, AND we are calling this method manually, without relying
   // on the exchange method to call it, then we need to rebuild all our internal buffer views
   if (!m_buffer_views_and_requests_built) {
+    assert (m_num_prepacked_3d_fields == 0);
     tstart("be build_buffer_views_and_requests");
     build_buffer_views_and_requests();
     tstop("be build_buffer_views_and_requests");
@@ -500,22 +537,28 @@ void BoundaryExchange::pack_and_send ()
   if (m_num_3d_fields > 0) {
     if (m_3d_nlev_pack_d.size() > 0)
       pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                          m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
+                          m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d,
+                          m_num_prepacked_3d_fields);
     else
       pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                    m_num_elems, m_num_3d_fields);
+                    m_num_elems, m_num_3d_fields, nullptr,
+                    m_num_prepacked_3d_fields);
   }
   // ...then pack 3d interface fields (if any)
   if (m_num_3d_int_fields > 0)
     pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
                     m_num_elems, m_num_3d_int_fields);
   Kokkos::fence();
+  m_num_prepacked_3d_fields = 0;
 
   // ---- Send ---- //
   tstart("be sync_send_buffer");
   m_buffers_manager->sync_send_buffer(this); // Deep copy send_buffer into mpi_send_buffer (no op if MPI is on device)
   tstop("be sync_send_buffer");
   tstart("be send");
+  // Publish the send buffer to the on-node neighbors
+  if (m_buffers_manager->use_node_window())
+    m_buffers_manager->node_fence();
   if ( ! m_send_requests.empty())
     HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
                             m_connectivity->get_comm().mpi_comm());
@@ -716,6 +759,12 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
   m_recv_pending = false;
   tstop("be recv waitall");
 
+  if (m_buffers_manager->use_node_window()) {
+    tstart("be recv node");
+    recv_from_node_neighbors();
+    tstop("be recv node");
+  }
+
   tstart("be recv_and_unpack book");
   m_buffers_manager->sync_recv_buffer(this);
 
@@ -863,6 +912,8 @@ void BoundaryExchange::pack_and_send_min_max ()
 
   // ---- Send ---- //
   m_buffers_manager->sync_send_buffer(this);
+  if (m_buffers_manager->use_node_window())
+    m_buffers_manager->node_fence();
   if ( ! m_send_requests.empty())
     HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
                             m_connectivity->get_comm().mpi_comm());
@@ -969,6 +1020,9 @@ void BoundaryExchange::recv_and_unpack_min_max ()
     HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
                             m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
 
+  if (m_buffers_manager->use_node_window())
+    recv_from_node_neighbors();
+
   m_buffers_manager->sync_recv_buffer(this); // Deep copy mpi_recv_buffer into recv_buffer (no op if MPI is on device)
 
   unpack_min_max(m_connectivity->get_d_ucon(), m_connectivity->get_d_ucon_ptr(),
@@ -1146,10 +1200,10 @@ void BoundaryExchange::build_buffer_views_and_requests()
     const auto mpi_comm = m_connectivity->get_comm().mpi_comm();
     const size_t npids = pids.size();
     free_requests();
-    m_send_requests.resize(npids);
-    m_recv_requests.resize(npids);
+    m_node_copies.clear();
     MPIViewManaged<Real*>::pointer_type send_ptr = buffers_manager->get_mpi_send_buffer().data();
     MPIViewManaged<Real*>::pointer_type recv_ptr = buffers_manager->get_mpi_recv_buffer().data();
+    std::vector<int> node_ranks;
     int offset = 0;
     for (size_t ip = 0; ip < npids; ++ip) {
       int count = 0;
@@ -1158,16 +1212,51 @@ void BoundaryExchange::build_buffer_views_and_requests()
         const auto& info = ucon(i);
         count += m_elem_buf_size[info.kind];
       }
-      HOMMEXX_MPI_CHECK_ERROR(MPI_Send_init(send_ptr + offset, count, MPI_DOUBLE,
-                                            pids[ip], m_exchange_type, mpi_comm,
-                                            &m_send_requests[ip]),
-                              m_connectivity->get_comm().mpi_comm());
-      HOMMEXX_MPI_CHECK_ERROR(MPI_Recv_init(recv_ptr + offset, count, MPI_DOUBLE,
-                                            pids[ip], m_exchange_type, mpi_comm,
-                                            &m_recv_requests[ip]),
-                              m_connectivity->get_comm().mpi_comm());
+      const int node_rank = (m_buffers_manager->use_node_window() ?
+                             m_connectivity->get_node_rank(pids[ip]) : -1);
+      if (node_rank >= 0) {
+        // On-node neighbor: we read its send buffer directly. The source
+        // pointer is set below, once we know the neighbor's offset.
+        node_ranks.push_back(node_rank);
+        m_node_copies.push_back(NodeCopy{nullptr, offset, count});
+      } else {
+        m_send_requests.emplace_back();
+        m_recv_requests.emplace_back();
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Send_init(send_ptr + offset, count, MPI_DOUBLE,
+                                              pids[ip], m_exchange_type, mpi_comm,
+                                              &m_send_requests.back()),
+                                m_connectivity->get_comm().mpi_comm());
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Recv_init(recv_ptr + offset, count, MPI_DOUBLE,
+                                              pids[ip], m_exchange_type, mpi_comm,
+                                              &m_recv_requests.back()),
+                                m_connectivity->get_comm().mpi_comm());
+      }
       offset += count;
     }
+
+    if ( ! m_node_copies.empty()) {
+      // Slots are ordered the same way on both sides of a connection, so the
+      // only thing we need from each on-node neighbor is where our block starts
+      // in its send buffer.
+      const auto node_comm = m_connectivity->get_node_comm().mpi_comm();
+      const int nnode = m_node_copies.size();
+      std::vector<int> remote_offsets(nnode);
+      std::vector<MPI_Request> reqs(2*nnode);
+      for (int i = 0; i < nnode; ++i) {
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Irecv(&remote_offsets[i], 1, MPI_INT, node_ranks[i],
+                                          m_exchange_type, node_comm, &reqs[i]),
+                                mpi_comm);
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Isend(&m_node_copies[i].offset, 1, MPI_INT, node_ranks[i],
+                                          m_exchange_type, node_comm, &reqs[nnode+i]),
+                                mpi_comm);
+      }
+      HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(reqs.size(), reqs.data(), MPI_STATUSES_IGNORE),
+                              mpi_comm);
+      for (int i = 0; i < nnode; ++i) {
+        m_node_copies[i].src = buffers_manager->get_node_send_buffer(node_ranks[i]) +
+                               remote_offsets[i];
+      }
+    }
   }
 
   // Now the buffer views and the requests are built
@@ -1186,6 +1275,20 @@ void BoundaryExchange
   m_recv_requests.clear();
 }
 
+void BoundaryExchange::recv_from_node_neighbors ()
+{
+  // All the ranks on the node wrote their send buffers before the fence in
+  // pack_and_send, so we can read from them directly.
+  Real* const recv_ptr = m_buffers_manager->get_mpi_recv_buffer().data();
+  for (const auto& nc : m_node_copies) {
+    std::copy(nc.src, nc.src + nc.count, recv_ptr + nc.offset);
+  }
+
+  // Our neighbors can't overwrite their send buffers until everyone on the node
+  // is done reading them.
+  m_buffers_manager->node_release();
+}
+
 // A slot is the space in a communication buffer for an (element, connection)
 // pair. The slot index space numbers slots so that, first, they are contiguous
 // by remote PID and, second, within a PID block, each comm partner agrees on
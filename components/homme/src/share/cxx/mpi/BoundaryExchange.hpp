@@ -102,6 +102,7 @@ public:
 
   // Set the connectivity if default constructor was used
   void set_connectivity (std::shared_ptr<Connectivity> connectivity);
+  std::shared_ptr<Connectivity> get_connectivity () const { return m_connectivity; }
 
   // Set the buffers manager (registration must not be completed)
   void set_buffers_manager (std::shared_ptr<MpiBuffersManager> buffers_manager);
@@ -215,6 +216,70 @@ public:
     ptr_type ptr;
   };
 
+  // Fused packing of the leading 3d fields. A kernel that computes the first
+  // num_3d_fields registered 3d fields can write them directly into the send
+  // buffers with pack_3d_field, rather than having pack_and_send re-read them
+  // from the field views. begin_prepacked locks the buffers and must be called
+  // before that kernel runs; the next exchange (or pack_and_send) then packs
+  // only the remaining fields.
+  void begin_prepacked (const int num_3d_fields);
+
+  // Undo begin_prepacked if the exchange that would consume the prepacked
+  // fields is not going to run. No-op if nothing is prepacked, in particular
+  // after that exchange's pack_and_send.
+  void cancel_prepacked ();
+
+  // Calls begin_prepacked (if num_3d_fields > 0) on construction and
+  // cancel_prepacked on destruction, so the buffers are not left locked if
+  // the packing kernel or anything else before the exchange throws.
+  class PrepackedScope {
+  public:
+    PrepackedScope (BoundaryExchange& be, const int num_3d_fields)
+      : m_be(be)
+    {
+      if (num_3d_fields > 0) m_be.begin_prepacked(num_3d_fields);
+    }
+    ~PrepackedScope () { m_be.cancel_prepacked(); }
+
+    PrepackedScope (const PrepackedScope&) = delete;
+    PrepackedScope& operator= (const PrepackedScope&) = delete;
+
+  private:
+    BoundaryExchange& m_be;
+  };
+
+  ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> get_send_3d_buffers () const {
+    return m_send_3d_buffers;
+  }
+
+  // Pack field ifield of element ie, with values f(ip,jp,ilev), into the send
+  // buffers. Team-level; the mapping matches pack_and_send's.
+  template <typename Field>
+  KOKKOS_INLINE_FUNCTION static void
+  pack_3d_field (const TeamMember& team, const ConnectionHelpers& helpers,
+                 const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*>& ucon,
+                 const ExecViewUnmanaged<const int*>& ucon_ptr,
+                 const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**>& send_3d_buffers,
+                 const int ie, const int ifield, const Field& f) {
+    const int iconn_end = ucon_ptr(ie+1);
+    for (int iconn = ucon_ptr(ie); iconn < iconn_end; ++iconn) {
+      const auto& info = ucon(iconn);
+      const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
+                                info.sharing_local_remote_iconn :
+                                iconn);
+      const auto& pts = helpers.CONNECTION_PTS[info.direction][info.local_dir];
+      const auto& sb = send_3d_buffers(ifield, buffer_iconn);
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, helpers.CONNECTION_SIZE[info.kind]),
+        [&] (const int k) {
+          Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, NUM_LEV),
+                               [&] (const int ilev) {
+            sb(k, ilev) = f(pts[k].ip, pts[k].jp, ilev);
+          });
+        });
+    }
+  }
+
   // Perform the pack_and_send and recv_and_unpack for boundary exchange of 2d/3d fields
   void pack_and_send ();
   void recv_and_unpack ();
@@ -248,9 +313,19 @@ private:
 
   int                       m_elem_buf_size[2];
 
+  // Persistent requests for the off-node neighbors (all the neighbors, unless
+  // MpiBuffersManager::use_node_window is true).
   std::vector<MPI_Request>  m_send_requests;
   std::vector<MPI_Request>  m_recv_requests;
 
+  // On-node neighbors: copy count Reals from the neighbor's mpi send buffer,
+  // starting at src, into our mpi recv buffer, starting at offset.
+  struct NodeCopy {
+    const Real* src;
+    int offset, count;
+  };
+  std::vector<NodeCopy>     m_node_copies;
+
   ExecViewManaged<ExecViewManaged<Scalar[2][NUM_LEV]>**>            m_1d_fields;
   ExecViewManaged<ExecViewManaged<Real[NP][NP]>**>                  m_2d_fields;
   ExecViewManaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV]>**>       m_3d_fields;
@@ -293,6 +368,9 @@ private:
   int         m_num_3d_fields;
   int         m_num_3d_int_fields;
 
+  // Number of leading 3d fields already packed by the caller (see begin_prepacked)
+  int         m_num_prepacked_3d_fields;
+
   // The following flags are used to ensure that a bad user does not call setup/cleanup/registration
   // methods of this class in an order that generate errors. And if he/she does, we try to avoid errors.
   bool        m_registration_started;
@@ -311,6 +389,7 @@ private:
     std::vector<int>& h_slot_idx_to_elem_conn_pair,
     std::vector<int>& pids, std::vector<int>& pids_os);
   void free_requests();
+  void recv_from_node_neighbors();
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 public: // This is semantically private but must be public for nvcc.
@@ -6,6 +6,7 @@
 
 #include "Connectivity.hpp"
 #include "ErrorDefs.hpp"
+#include "Hommexx_Debug.hpp"
 
 #include <array>
 #include <algorithm>
@@ -136,10 +137,46 @@ void Connectivity::finalize(const bool sanity_check)
   }
 
   setup_ucon();
+#if HOMMEXX_MPI_SHARED_NODE
+  setup_node_comm();
+#endif
 
   m_finalized = true;
 }
 
+void Connectivity::setup_node_comm () {
+  free_node_comm();
+
+  MPI_Comm node_comm;
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Comm_split_type(m_comm.mpi_comm(), MPI_COMM_TYPE_SHARED,
+                                              m_comm.rank(), MPI_INFO_NULL, &node_comm),
+                          m_comm.mpi_comm());
+  m_node_comm.reset_mpi_comm(node_comm);
+
+  // Map each rank in m_comm to its rank in the node comm (MPI_UNDEFINED if off
+  // node).
+  MPI_Group group, node_group;
+  MPI_Comm_group(m_comm.mpi_comm(), &group);
+  MPI_Comm_group(node_comm, &node_group);
+  std::vector<int> pids(m_comm.size());
+  for (int i = 0; i < m_comm.size(); ++i) pids[i] = i;
+  m_node_ranks.resize(m_comm.size());
+  MPI_Group_translate_ranks(group, m_comm.size(), pids.data(), node_group,
+                            m_node_ranks.data());
+  for (auto& r : m_node_ranks)
+    if (r == MPI_UNDEFINED) r = -1;
+  MPI_Group_free(&group);
+  MPI_Group_free(&node_group);
+}
+
+void Connectivity::free_node_comm () {
+  if (m_node_ranks.empty()) return;
+  MPI_Comm node_comm = m_node_comm.mpi_comm();
+  MPI_Comm_free(&node_comm);
+  m_node_comm.reset_mpi_comm(MPI_COMM_SELF);
+  m_node_ranks.clear();
+}
+
 bool Connectivity::UConInfo::operator< (const UConInfo& o) const {
   // Sort on local (L/G)ID so that element data are contiguous.
   if (l_lid < o.l_lid) return true;
@@ -323,6 +360,8 @@ void Connectivity::clean_up()
   d_ucon_ptr = decltype(d_ucon_ptr)("", 0);
   h_ucon_ptr = decltype(h_ucon_ptr)("", 0);
 
+  free_node_comm();
+
   m_initialized = false;
   m_finalized   = false;
 }
@@ -11,6 +11,8 @@
 #include "Comm.hpp"
 #include "Types.hpp"
 
+#include <vector>
+
 namespace Homme
 {
 struct LidGidPos
@@ -129,6 +131,14 @@ public:
   bool is_finalized   () const { return m_finalized;   }
 
   const Comm& get_comm () const { return m_comm; }
+
+  // The ranks of m_comm that share memory with this rank (HOMMEXX_MPI_SHARED_NODE
+  // only), and the rank in the node comm of a given rank of m_comm, or -1 if
+  // that rank lives on a different node.
+  const Comm& get_node_comm () const { return m_node_comm; }
+  int get_node_rank (const int pid) const {
+    return m_node_ranks.empty() ? -1 : m_node_ranks[pid];
+  }
   //@}
 
 private:
@@ -138,6 +148,8 @@ private:
   static constexpr std::uint8_t INVALID_DIR = 0xFF;
 
   Comm    m_comm;
+  Comm    m_node_comm;
+  std::vector<int> m_node_ranks;
 
   bool    m_finalized;
   bool    m_initialized;
@@ -167,6 +179,9 @@ private:
   // In finalize call, construct the unstructured connectivity data using
   // ucon_info.
   void setup_ucon();
+  // In finalize call, split m_comm into shared-memory comms.
+  void setup_node_comm();
+  void free_node_comm();
 };
 
 } // namespace Homme
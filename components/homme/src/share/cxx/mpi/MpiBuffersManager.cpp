@@ -8,6 +8,8 @@
 
 #include "BoundaryExchange.hpp"
 #include "Connectivity.hpp"
+#include "Hommexx_Debug.hpp"
+#include "ErrorDefs.hpp"
 
 namespace Homme
 {
@@ -18,6 +20,9 @@ MpiBuffersManager::MpiBuffersManager ()
  , m_local_buffer_size (0)
  , m_buffers_busy      (false)
  , m_views_are_valid   (false)
+ , m_use_node_window   (node_window_supported)
+ , m_node_window       (MPI_WIN_NULL)
+ , m_max_elem_buf_size {0, 0}
 {
   // The "fake" buffers used for MISSING connections. These do not depend on the requirements
   // from the custormers, so we can create them right away.
@@ -41,6 +46,8 @@ MpiBuffersManager::~MpiBuffersManager ()
 
   // Check our buffers are not busy
   assert (!m_buffers_busy);
+
+  free_node_window();
 }
 
 void MpiBuffersManager::check_for_reallocation ()
@@ -71,17 +78,23 @@ void MpiBuffersManager::allocate_buffers ()
 {
   // If views are marked as valid, they are already allocated, and no other
   // customer has requested a larger size
+  // Note: with the node window, m_views_are_valid is the same on all the ranks
+  //       of the node (see update_requested_sizes), so they all get here together.
   if (m_views_are_valid) {
     return;
   }
 
   // The buffers used for packing/unpacking
-  m_send_buffer  = ExecViewManaged<Real*>("send buffer",  m_mpi_buffer_size);
   m_recv_buffer  = ExecViewManaged<Real*>("recv buffer",  m_mpi_buffer_size);
   m_local_buffer = ExecViewManaged<Real*>("local buffer", m_local_buffer_size);
 
   // The buffers used in MPI calls
-  m_mpi_send_buffer = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer)::execution_space(),m_send_buffer);
+  if (m_use_node_window) {
+    allocate_node_window();
+  } else {
+    m_send_buffer     = ExecViewManaged<Real*>("send buffer",  m_mpi_buffer_size);
+    m_mpi_send_buffer = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer)::execution_space(),m_send_buffer);
+  }
   m_mpi_recv_buffer = Kokkos::create_mirror_view(decltype(m_mpi_recv_buffer)::execution_space(),m_recv_buffer);
 
   m_views_are_valid = true;
@@ -93,6 +106,106 @@ void MpiBuffersManager::allocate_buffers ()
   }
 }
 
+void MpiBuffersManager::set_use_node_window (const bool use)
+{
+  // Can't switch once the buffers have been allocated
+  assert (!m_views_are_valid && m_node_window==MPI_WIN_NULL);
+
+  m_use_node_window = use && node_window_supported;
+}
+
+void MpiBuffersManager::allocate_node_window ()
+{
+  free_node_window();
+
+  const auto node_comm = m_connectivity->get_node_comm().mpi_comm();
+
+  // The window allocation below is collective, and each rank decided to get
+  // here on its own. Check once, while setting up, that all the ranks on the
+  // node have the same customers' needs. If they did not, they would not agree
+  // on later reallocations either.
+  int sizes[4] = { m_max_elem_buf_size[0],  m_max_elem_buf_size[1],
+                  -m_max_elem_buf_size[0], -m_max_elem_buf_size[1]};
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Allreduce(MPI_IN_PLACE, sizes, 4, MPI_INT, MPI_MAX, node_comm),
+                          m_connectivity->get_comm().mpi_comm());
+  if (sizes[0]!=-sizes[2] || sizes[1]!=-sizes[3]) {
+    Errors::runtime_abort("Error! The ranks on this node registered different boundary exchange fields,\n"
+                          "       which the shared-memory node window does not support.\n",
+                          Errors::err_mpi_node_mismatch);
+  }
+  MPI_Info info;
+  MPI_Info_create(&info);
+  // Let MPI put each rank's segment in memory close to that rank
+  MPI_Info_set(info, "alloc_shared_noncontig", "true");
+  Real* ptr = nullptr;
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Win_allocate_shared(m_mpi_buffer_size*sizeof(Real), sizeof(Real), info,
+                                                  node_comm, &ptr, &m_node_window),
+                          m_connectivity->get_comm().mpi_comm());
+  MPI_Info_free(&info);
+
+  // Keep a passive target epoch open for the whole life of the window. Accesses
+  // are synchronized with node_fence.
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Win_lock_all(MPI_MODE_NOCHECK, m_node_window),
+                          m_connectivity->get_comm().mpi_comm());
+
+  // Note: views built from a pointer do not own the memory, which is released
+  //       in free_node_window.
+  m_mpi_send_buffer = MPIViewManaged<Real*>(ptr, m_mpi_buffer_size);
+  if (std::is_same<MPIMemSpace,ExecMemSpace>::value) {
+    m_send_buffer = ExecViewManaged<Real*>(ptr, m_mpi_buffer_size);
+  } else {
+    m_send_buffer = ExecViewManaged<Real*>("send buffer", m_mpi_buffer_size);
+  }
+}
+
+void MpiBuffersManager::free_node_window ()
+{
+  if (m_node_window==MPI_WIN_NULL) {
+    return;
+  }
+
+  // Nothing we can do if MPI is already gone
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (finalized==0) {
+    MPI_Win_unlock_all(m_node_window);
+    MPI_Win_free(&m_node_window);
+  }
+  m_node_window = MPI_WIN_NULL;
+}
+
+const Real* MpiBuffersManager::get_node_send_buffer (const int node_rank) const
+{
+  assert (m_use_node_window && m_views_are_valid);
+
+  MPI_Aint size;
+  int disp_unit;
+  Real* ptr;
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Win_shared_query(m_node_window, node_rank, &size, &disp_unit, &ptr),
+                          m_connectivity->get_comm().mpi_comm());
+  return ptr;
+}
+
+void MpiBuffersManager::node_fence () const
+{
+  assert (m_use_node_window);
+
+  // Memory barriers on both sides of the process barrier, as required by the
+  // unified memory model of shared windows
+  MPI_Win_sync(m_node_window);
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Barrier(m_connectivity->get_node_comm().mpi_comm()),
+                          m_connectivity->get_comm().mpi_comm());
+  MPI_Win_sync(m_node_window);
+}
+
+void MpiBuffersManager::node_release () const
+{
+  assert (m_use_node_window);
+
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Barrier(m_connectivity->get_node_comm().mpi_comm()),
+                          m_connectivity->get_comm().mpi_comm());
+}
+
 void MpiBuffersManager::lock_buffers ()
 {
   // Make sure we are not trying to lock buffers already locked
@@ -165,6 +278,33 @@ void MpiBuffersManager::update_requested_sizes (typename std::map<BoundaryExchan
 
   // Compute the requested buffers sizes and compare with stored ones
   required_buffer_sizes (num_1d_fields, num_2d_fields, num_3d_fields, num_3d_int_fields, customer.second.mpi_buffer_size, customer.second.local_buffer_size);
+
+  if (m_use_node_window) {
+    // Size the buffers from the largest slot of each connection kind. Whether
+    // that grows depends only on the field counts, so all the ranks on the node
+    // invalidate their views (and later reallocate the window) together, even
+    // if they have different numbers of connections.
+    int elem_buf_size[2];
+    required_elem_buffer_sizes (num_1d_fields, num_2d_fields, num_3d_fields, num_3d_int_fields, elem_buf_size);
+    bool grew = false;
+    for (int kind : {etoi(ConnectionKind::CORNER), etoi(ConnectionKind::EDGE)}) {
+      if (elem_buf_size[kind]>m_max_elem_buf_size[kind]) {
+        m_max_elem_buf_size[kind] = elem_buf_size[kind];
+        grew = true;
+      }
+    }
+    if (grew) {
+      const int corner = etoi(ConnectionKind::CORNER);
+      const int edge   = etoi(ConnectionKind::EDGE);
+      m_mpi_buffer_size   = m_max_elem_buf_size[corner] * m_connectivity->get_num_connections<HostMemSpace>(ConnectionSharing::SHARED,ConnectionKind::CORNER)
+                          + m_max_elem_buf_size[edge]   * m_connectivity->get_num_connections<HostMemSpace>(ConnectionSharing::SHARED,ConnectionKind::EDGE);
+      m_local_buffer_size = m_max_elem_buf_size[corner] * m_connectivity->get_num_connections<HostMemSpace>(ConnectionSharing::LOCAL,ConnectionKind::CORNER)
+                          + m_max_elem_buf_size[edge]   * m_connectivity->get_num_connections<HostMemSpace>(ConnectionSharing::LOCAL,ConnectionKind::EDGE);
+      m_views_are_valid = false;
+    }
+    return;
+  }
+
   if (customer.second.mpi_buffer_size>m_mpi_buffer_size) {
     // Update the total
     m_mpi_buffer_size = customer.second.mpi_buffer_size;
@@ -182,6 +322,17 @@ void MpiBuffersManager::update_requested_sizes (typename std::map<BoundaryExchan
   }
 }
 
+void MpiBuffersManager::required_elem_buffer_sizes (const int num_1d_fields, const int num_2d_fields,
+                                                    const int num_3d_fields, const int num_3d_interface_fields,
+                                                    int elem_buf_size[2]) const
+{
+  // Note: for 2d/3d fields, we have 1 Real per GP (per level, in 3d). For 1d fields,
+  //       we have 2 Real per level (max and min over element).
+  const int pt_buf_size = num_2d_fields + num_3d_fields*NUM_LEV*VECTOR_SIZE + num_3d_interface_fields*NUM_LEV_P*VECTOR_SIZE;
+  elem_buf_size[etoi(ConnectionKind::CORNER)] = num_1d_fields*2*NUM_LEV*VECTOR_SIZE + pt_buf_size * 1;
+  elem_buf_size[etoi(ConnectionKind::EDGE)]   = num_1d_fields*2*NUM_LEV*VECTOR_SIZE + pt_buf_size * NP;
+}
+
 void MpiBuffersManager::required_buffer_sizes (const int num_1d_fields, const int num_2d_fields,
                                                const int num_3d_fields, const int num_3d_interface_fields,
                                                size_t& mpi_buffer_size, size_t& local_buffer_size) const
@@ -189,12 +340,8 @@ void MpiBuffersManager::required_buffer_sizes (const int num_1d_fields, const in
   mpi_buffer_size = local_buffer_size = 0;
 
   // The buffer size for each connection kind
-  // Note: for 2d/3d fields, we have 1 Real per GP (per level, in 3d). For 1d fields,
-  //       we have 2 Real per level (max and min over element).
   int elem_buf_size[2];
-  const int pt_buf_size = num_2d_fields + num_3d_fields*NUM_LEV*VECTOR_SIZE + num_3d_interface_fields*NUM_LEV_P*VECTOR_SIZE;
-  elem_buf_size[etoi(ConnectionKind::CORNER)] = num_1d_fields*2*NUM_LEV*VECTOR_SIZE + pt_buf_size * 1;
-  elem_buf_size[etoi(ConnectionKind::EDGE)]   = num_1d_fields*2*NUM_LEV*VECTOR_SIZE + pt_buf_size * NP;
+  required_elem_buffer_sizes (num_1d_fields, num_2d_fields, num_3d_fields, num_3d_interface_fields, elem_buf_size);
 
   // Compute the requested buffers sizes and compare with stored ones
   mpi_buffer_size += elem_buf_size[etoi(ConnectionKind::CORNER)] * m_connectivity->get_num_connections<HostMemSpace>(ConnectionSharing::SHARED,ConnectionKind::CORNER);
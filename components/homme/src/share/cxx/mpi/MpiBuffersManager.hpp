@@ -12,6 +12,9 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <type_traits>
+
+#include <mpi.h>
 
 #include "MpiHelpers.hpp"
 
@@ -70,6 +73,16 @@ class BoundaryExchange;
  * which is a no-op if the MPIMemSpace=ExecMemSpace, that is, if
  * the MPI is performed using pointers on the Execution Space.
  *
+ * If HOMMEXX_MPI_SHARED_NODE is on (and the MPI buffers are on host),
+ * the mpi_send buffer is allocated in an MPI-3 shared-memory window
+ * over the node comm (see Connectivity::get_node_comm). A BE customer
+ * then reads the data sent by its on-node neighbors directly from their
+ * mpi_send buffers, and only exchanges messages with off-node ranks.
+ * In this mode, allocate_buffers is collective over the node comm. To
+ * make every rank reach the same decision without communicating, the
+ * buffers are sized from the largest per-connection slot requested by
+ * any customer, which depends only on the customers' field counts.
+ *
  */
 
 class MpiBuffersManager
@@ -116,6 +129,33 @@ public:
 
   std::shared_ptr<Connectivity> get_connectivity () const { return m_connectivity; }
 
+  // Whether this build can put the mpi_send buffer in a shared window over the node comm
+  static constexpr bool node_window_supported =
+    HOMMEXX_MPI_SHARED_NODE && std::is_same<MPIMemSpace,HostMemSpace>::value;
+
+  // Whether the mpi_send buffer lives in a shared window over the node comm.
+  // On by default if supported. It can only be changed before the buffers are
+  // first allocated (the unit test uses this to compare against plain messages).
+  bool use_node_window () const { return m_use_node_window; }
+  void set_use_node_window (const bool use);
+
+  // The mpi_send buffer of the given rank in the node comm
+  const Real* get_node_send_buffer (const int node_rank) const;
+
+  // Synchronize the shared window across the node comm. After this call,
+  // what every rank wrote in its mpi_send buffer before the call is visible
+  // to all the ranks in the node.
+  void node_fence () const;
+
+  // Called once a rank is done reading its on-node neighbors' send buffers.
+  // After this call, whatever every rank read before the call can be
+  // overwritten. The mpi_send buffer is shared by all the customers of this
+  // manager, so without it the next pack of any customer on a fast rank could
+  // overwrite data a slower neighbor is still reading. It is a process barrier
+  // only: no data is published, and the next node_fence syncs the window
+  // before anyone reads it again.
+  void node_release () const;
+
 private:
 
   // Make BoundaryExchange a friend, so it can call the next four methods underneath
@@ -145,6 +185,15 @@ private:
   // Note: this method does not (re)allocate views
   void update_requested_sizes (std::map<BoundaryExchange*,CustomerNeeds>::value_type& customer);
 
+  // (Re)create/destroy the shared window for the mpi_send buffer
+  void allocate_node_window ();
+  void free_node_window ();
+
+  // The buffer size of a single connection of each kind (CORNER/EDGE)
+  void required_elem_buffer_sizes (const int num_1d_fields, const int num_2d_fields,
+                                   const int num_3d_fields, const int num_3d_interface_fields,
+                                   int elem_buf_size[2]) const;
+
   // Computes the required storages
   void required_buffer_sizes (const int num_1d_fields, const int num_2d_fields,
                               const int num_3d_fields, const int num_3d_interface_fields,
@@ -181,6 +230,13 @@ private:
   // The blackhole send/recv buffers (used for missing connections)
   ExecViewManaged<Real*>  m_blackhole_send_buffer;
   ExecViewManaged<Real*>  m_blackhole_recv_buffer;
+
+  // The shared window owning the memory of m_mpi_send_buffer (if use_node_window)
+  bool                    m_use_node_window;
+  MPI_Win                 m_node_window;
+
+  // The largest per-connection slot requested by any customer (if use_node_window)
+  int                     m_max_elem_buf_size[2];
 };
 
 inline void MpiBuffersManager::sync_send_buffer (BoundaryExchange* customer)
@@ -0,0 +1,260 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#include "SfcPartitioner.hpp"
+#include "ErrorDefs.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace Homme {
+
+std::uint64_t hilbert_index_3d (const std::uint32_t x_in[3], const int nbits) {
+  // J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004.
+  // Convert the axes to the "transpose" form of the Hilbert index, then
+  // interleave the bits.
+  static constexpr int n = 3;
+  std::uint32_t x[n] = {x_in[0], x_in[1], x_in[2]};
+  const std::uint32_t m = std::uint32_t(1) << (nbits-1);
+  // Inverse undo.
+  for (std::uint32_t q = m; q > 1; q >>= 1) {
+    const std::uint32_t p = q - 1;
+    for (int i = 0; i < n; ++i) {
+      if (x[i] & q) {
+        x[0] ^= p;
+      } else {
+        const std::uint32_t t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+  // Gray encode.
+  for (int i = 1; i < n; ++i) x[i] ^= x[i-1];
+  std::uint32_t t = 0;
+  for (std::uint32_t q = m; q > 1; q >>= 1)
+    if (x[n-1] & q) t ^= q - 1;
+  for (int i = 0; i < n; ++i) x[i] ^= t;
+
+  std::uint64_t h = 0;
+  for (int b = nbits-1; b >= 0; --b)
+    for (int i = 0; i < n; ++i)
+      h = (h << 1) | ((x[i] >> b) & 1);
+  return h;
+}
+
+namespace {
+
+// 3*21 bits fit in the 64-bit index.
+constexpr int hilbert_nbits = 21;
+
+inline double vertex_weight (const double* vwgt, const int i) {
+  return vwgt ? vwgt[i] : 1.0;
+}
+
+inline double cut_cost (const SfcPartitionParams& p, const int pa, const int pb,
+                        const double w) {
+  if (pa == pb) return 0;
+  const bool same_node = pa/p.parts_per_node == pb/p.parts_per_node;
+  return same_node ? w : p.off_node_factor*w;
+}
+
+// Order the vertices along the Hilbert curve through their coordinates,
+// normalized to the bounding box of all vertices. Ties (e.g., from 2D
+// coordinates) are broken by vertex index, so the order is deterministic.
+std::vector<int> sfc_order (const int nvtx, const double* x, const double* y,
+                            const double* z) {
+  const double* c[3] = {x, y, z};
+  double lo[3], hi[3];
+  for (int d = 0; d < 3; ++d) {
+    lo[d] = std::numeric_limits<double>::max();
+    hi[d] = std::numeric_limits<double>::lowest();
+    if ( ! c[d]) continue;
+    for (int i = 0; i < nvtx; ++i) {
+      lo[d] = std::min(lo[d], c[d][i]);
+      hi[d] = std::max(hi[d], c[d][i]);
+    }
+  }
+
+  const double nmax = double((std::uint32_t(1) << hilbert_nbits) - 1);
+  std::vector<std::pair<std::uint64_t,int> > keys(nvtx);
+  for (int i = 0; i < nvtx; ++i) {
+    std::uint32_t q[3] = {0, 0, 0};
+    for (int d = 0; d < 3; ++d) {
+      if ( ! c[d] || hi[d] <= lo[d]) continue;
+      q[d] = std::uint32_t(nmax*(c[d][i] - lo[d])/(hi[d] - lo[d]));
+    }
+    keys[i] = std::make_pair(hilbert_index_3d(q, hilbert_nbits), i);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  std::vector<int> order(nvtx);
+  for (int i = 0; i < nvtx; ++i) order[i] = keys[i].second;
+  return order;
+}
+
+// Cut the curve into nparts chunks of approximately equal weight. Each part
+// gets at least one vertex.
+void cut_curve (const std::vector<int>& order, const double* vwgt,
+                const int nparts, int* part) {
+  const int nvtx = order.size();
+  double wtot = 0;
+  for (int i = 0; i < nvtx; ++i) wtot += vertex_weight(vwgt, i);
+  const double target = wtot/nparts;
+
+  int p = 0, cnt = 0;
+  double acc = 0;
+  for (int k = 0; k < nvtx; ++k) {
+    const double w = vertex_weight(vwgt, order[k]);
+    // Move on to the next part once this one reaches its target (rounding at
+    // the midpoint of the vertex), or if every remaining vertex is needed to
+    // fill the remaining parts.
+    if (p < nparts-1 && cnt > 0 &&
+        (acc + 0.5*w > (p+1)*target || nvtx - k == nparts - 1 - p)) {
+      ++p;
+      cnt = 0;
+    }
+    part[order[k]] = p;
+    acc += w;
+    ++cnt;
+  }
+}
+
+// Greedy boundary refinement. Vertices are visited in curve order; a vertex
+// moves to the neighboring part with the largest positive cost reduction that
+// keeps the destination under maxload. Zero-gain moves are taken only if they
+// reduce the imbalance between the two parts.
+void refine (const int nvtx, const int* xadj, const int* adjncy,
+             const double* adjwgt, const double* vwgt,
+             const SfcPartitionParams& p, const std::vector<int>& order,
+             int* part) {
+  std::vector<double> load(p.nparts, 0);
+  std::vector<int> count(p.nparts, 0);
+  for (int i = 0; i < nvtx; ++i) {
+    load[part[i]] += vertex_weight(vwgt, i);
+    ++count[part[i]];
+  }
+  const double avg = std::accumulate(load.begin(), load.end(), 0.0)/p.nparts;
+  const double maxload = std::max(p.imbalance_tol*avg,
+                                  *std::max_element(load.begin(), load.end()));
+
+  std::vector<int> cand;
+  for (int pass = 0; pass < p.refine_passes; ++pass) {
+    int nmoved = 0;
+    for (const int v : order) {
+      const int a = part[v];
+      if (count[a] == 1) continue;
+      const double wv = vertex_weight(vwgt, v);
+
+      cand.clear();
+      for (int j = xadj[v]; j < xadj[v+1]; ++j) {
+        const int b = part[adjncy[j]];
+        if (b != a && std::find(cand.begin(), cand.end(), b) == cand.end())
+          cand.push_back(b);
+      }
+
+      double cost_a = 0;
+      for (int j = xadj[v]; j < xadj[v+1]; ++j)
+        cost_a += cut_cost(p, a, part[adjncy[j]], adjwgt[j]);
+
+      int best = -1;
+      double best_gain = 0;
+      for (const int b : cand) {
+        if (load[b] + wv > maxload) continue;
+        double cost_b = 0;
+        for (int j = xadj[v]; j < xadj[v+1]; ++j)
+          cost_b += cut_cost(p, b, part[adjncy[j]], adjwgt[j]);
+        const double gain = cost_a - cost_b;
+        const bool take = (gain > best_gain ||
+                           (best < 0 && gain == 0 && load[b] + wv < load[a]));
+        if (take) {
+          best = b;
+          best_gain = gain;
+        }
+      }
+      if (best < 0) continue;
+
+      part[v] = best;
+      load[a] -= wv; --count[a];
+      load[best] += wv; ++count[best];
+      ++nmoved;
+    }
+    if (nmoved == 0) break;
+  }
+}
+
+} // anonymous namespace
+
+void sfc_partition (const int nvtx, const int* xadj, const int* adjncy,
+                    const double* adjwgt, const double* vwgt,
+                    const double* x, const double* y, const double* z,
+                    const SfcPartitionParams& params, int* part) {
+  Errors::runtime_check(params.nparts >= 1 && params.nparts <= nvtx,
+                        "sfc_partition: need 1 <= nparts <= nvtx, got nparts = " +
+                        std::to_string(params.nparts) + ", nvtx = " +
+                        std::to_string(nvtx),
+                        Errors::err_invalid_options_combination);
+  Errors::runtime_check(params.parts_per_node >= 1,
+                        "sfc_partition: parts_per_node must be >= 1",
+                        Errors::err_invalid_options_combination);
+  if (vwgt) {
+    for (int i = 0; i < nvtx; ++i)
+      Errors::runtime_check(vwgt[i] > 0, "sfc_partition: vertex weights must be positive",
+                            Errors::err_invalid_options_combination);
+  }
+
+  const auto order = sfc_order(nvtx, x, y, z);
+  cut_curve(order, vwgt, params.nparts, part);
+  if (params.refine_passes > 0 && params.nparts > 1)
+    refine(nvtx, xadj, adjncy, adjwgt, vwgt, params, order, part);
+}
+
+PartitionMetrics
+compute_partition_metrics (const int nvtx, const int* xadj, const int* adjncy,
+                           const double* adjwgt, const double* vwgt,
+                           const SfcPartitionParams& params, const int* part) {
+  std::vector<double> load(params.nparts, 0);
+  PartitionMetrics m;
+  m.edge_cut = m.off_node_edge_cut = 0;
+  for (int i = 0; i < nvtx; ++i) {
+    load[part[i]] += vertex_weight(vwgt, i);
+    for (int j = xadj[i]; j < xadj[i+1]; ++j) {
+      const int pi = part[i], pj = part[adjncy[j]];
+      if (pi == pj) continue;
+      // Each edge is seen from both ends.
+      m.edge_cut += 0.5*adjwgt[j];
+      if (pi/params.parts_per_node != pj/params.parts_per_node)
+        m.off_node_edge_cut += 0.5*adjwgt[j];
+    }
+  }
+  m.max_load = *std::max_element(load.begin(), load.end());
+  m.avg_load = std::accumulate(load.begin(), load.end(), 0.0)/params.nparts;
+  return m;
+}
+
+extern "C" {
+
+// Fortran entry point, see zoltan_mod::gennativepart. The output part IDs are
+// 1-based, as expected in GridVertex%processor_number.
+void homme_sfc_partition (const int nvtx, const int* xadj, const int* adjncy,
+                          const double* adjwgt, const double* vwgt,
+                          const double* x, const double* y, const double* z,
+                          const int coord_dimension, const int nparts,
+                          const int parts_per_node, int* part) {
+  SfcPartitionParams params;
+  params.nparts = nparts;
+  params.parts_per_node = std::max(1, parts_per_node);
+  sfc_partition(nvtx, xadj, adjncy, adjwgt, vwgt, x, y,
+                coord_dimension == 3 ? z : nullptr, params, part);
+  for (int i = 0; i < nvtx; ++i) ++part[i];
+}
+
+} // extern "C"
+
+} // namespace Homme
@@ -0,0 +1,68 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#ifndef HOMMEXX_SFC_PARTITIONER_HPP
+#define HOMMEXX_SFC_PARTITIONER_HPP
+
+#include <cstdint>
+
+/* A self-contained element partitioner, for use when Zoltan2 is not available.
+
+   Elements are ordered along a 3D Hilbert space-filling curve through their
+   center coordinates, and the curve is cut into nparts contiguous chunks of
+   (approximately) equal total vertex weight. An optional refinement pass then
+   greedily moves boundary elements to a neighboring part if that lowers the
+   communication cost without exceeding the load tolerance. The cost of a cut
+   edge is its weight, times off_node_factor if the two parts live on different
+   nodes, assuming parts are packed parts_per_node to a node in rank order.
+
+   Vertex weights are arbitrary positive reals, so a measured per-element cost
+   (e.g., from physics) can be fed back to rebalance the decomposition.
+
+   The algorithm is serial and deterministic, so all ranks can compute the
+   same partition redundantly from the same global graph.
+ */
+
+namespace Homme {
+
+struct SfcPartitionParams {
+  int nparts = 1;
+  // Number of consecutive parts (i.e., ranks) sharing a node.
+  int parts_per_node = 1;
+  // Cost multiplier for cut edges that cross a node boundary.
+  double off_node_factor = 4;
+  // During refinement, no part may exceed this factor times the average load
+  // (or the max load of the initial SFC cut, if larger).
+  double imbalance_tol = 1.05;
+  // Number of refinement sweeps. 0 means pure SFC partition.
+  int refine_passes = 4;
+};
+
+struct PartitionMetrics {
+  double max_load, avg_load;
+  // Total weight of cut edges, and of the subset crossing node boundaries.
+  double edge_cut, off_node_edge_cut;
+};
+
+// Index of the point x in [0,2^nbits)^3 along the Hilbert curve.
+std::uint64_t hilbert_index_3d (const std::uint32_t x[3], const int nbits);
+
+// Partition the graph given in 0-based CSR format (xadj, adjncy, adjwgt), with
+// vertex weights vwgt (nullptr for unit weights) and vertex coordinates
+// (x,y,z). On output, part[i] in [0,nparts) is the part of vertex i.
+void sfc_partition (const int nvtx, const int* xadj, const int* adjncy,
+                    const double* adjwgt, const double* vwgt,
+                    const double* x, const double* y, const double* z,
+                    const SfcPartitionParams& params, int* part);
+
+PartitionMetrics
+compute_partition_metrics (const int nvtx, const int* xadj, const int* adjncy,
+                           const double* adjwgt, const double* vwgt,
+                           const SfcPartitionParams& params, const int* part);
+
+} // namespace Homme
+
+#endif // HOMMEXX_SFC_PARTITIONER_HPP
@@ -105,6 +105,7 @@ struct CaarFunctorImpl {
 
   struct TagPreExchange {};
   struct TagPostExchange {};
+  struct TagPostExchangeTiled {};
 
   // Policies
 #ifndef NDEBUG
@@ -115,9 +116,17 @@ struct CaarFunctorImpl {
   using TeamPolicyType = Kokkos::TeamPolicy<ExecSpace,Tag>;
 #endif
 
+  // Number of consecutive elements processed by one team. On CPU, elements
+  // are grouped in tiles, one per thread, and both the pre- and post-exchange
+  // phases walk the same tiles, so an element stays on the same core (and in
+  // its cache) for the whole RK stage, and each team reuses its workspace
+  // slot for all the elements of its tile. On GPU, the tile size is 1.
+  const int m_tile_size;
+
   TeamPolicyType<TagPreExchange>   m_policy_pre;
 
   Kokkos::RangePolicy<ExecSpace, TagPostExchange> m_policy_post;
+  TeamPolicyType<TagPostExchangeTiled> m_policy_post_tiled;
 
   TeamUtils<ExecSpace> m_tu;
 
@@ -137,8 +146,10 @@ struct CaarFunctorImpl {
       , m_geometry(elements.m_geometry)
       , m_deriv(ref_FE.get_deriv())
       , m_sphere_ops(sphere_ops)
-      , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
+      , m_tile_size (tile_size(m_num_elems))
+      , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(num_tiles()))
       , m_policy_post (0,m_num_elems*NP*NP)
+      , m_policy_post_tiled (Homme::get_default_team_policy<ExecSpace,TagPostExchangeTiled>(num_tiles()))
       , m_tu(m_policy_pre)
   {
     // Initialize equation of state
@@ -154,8 +165,10 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
-      , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
+      , m_tile_size (tile_size(m_num_elems))
+      , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(num_tiles()))
       , m_policy_post (0,num_elems*NP*NP)
+      , m_policy_post_tiled (Homme::get_default_team_policy<ExecSpace,TagPostExchangeTiled>(num_tiles()))
       , m_tu(m_policy_pre)
   {}
 
@@ -178,6 +191,16 @@ struct CaarFunctorImpl {
     m_sphere_ops.allocate_buffers(m_tu);
   }
 
+  static int tile_size (const int num_elems) {
+    if (OnGpu<ExecSpace>::value || num_elems <= 0) return 1;
+    const int concurrency = ExecSpace::concurrency();
+    return (num_elems + concurrency - 1) / concurrency;
+  }
+
+  int num_tiles () const {
+    return (m_num_elems + m_tile_size - 1) / m_tile_size;
+  }
+
   int requested_buffer_size () const {
     // Ask the buffers manager to allocate enough buffers to satisfy Caar's needs
     const int nslots = m_tu.get_num_ws_slots();
@@ -360,7 +383,11 @@ struct CaarFunctorImpl {
 
     if (!m_theta_hydrostatic_mode) {
       GPTLstart("caar compute");
-      Kokkos::parallel_for("caar loop post-boundary exchange", m_policy_post, *this);
+      if (m_tile_size > 1) {
+        Kokkos::parallel_for("caar loop post-boundary exchange", m_policy_post_tiled, *this);
+      } else {
+        Kokkos::parallel_for("caar loop post-boundary exchange", m_policy_post, *this);
+      }
       Kokkos::fence();
       GPTLstop("caar compute");
     }
@@ -372,11 +399,25 @@ struct CaarFunctorImpl {
 
   KOKKOS_INLINE_FUNCTION
   void operator()(const TagPreExchange&, const TeamMember &team, int& nerr) const {
+    KernelVariables kv(team, m_tu);
+
+    const int ie_beg = team.league_rank()*m_tile_size;
+    const int ie_end = ie_beg+m_tile_size < m_num_elems ? ie_beg+m_tile_size : m_num_elems;
+    for (int ie=ie_beg; ie<ie_end; ++ie) {
+      // The team's buffers are reused for the next element of the tile
+      if (ie>ie_beg) {
+        kv.team_barrier();
+      }
+      kv.ie = ie;
+      compute_pre_exchange(kv,nerr);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void compute_pre_exchange(KernelVariables& kv, int& nerr) const {
     // In this body, we use '====' to separate sync epochs (delimited by barriers)
     // Note: make sure the same temp is not used within each epoch!
 
-    KernelVariables kv(team, m_tu);
-
     // =========== EPOCH 1 =========== //
     compute_div_vdp(kv);
 
@@ -429,6 +470,27 @@ struct CaarFunctorImpl {
 
   KOKKOS_INLINE_FUNCTION
   void operator()(const TagPostExchange&, const int idx) const {
+    const int ie  = idx / (NP*NP);
+    const int igp = (idx / NP) % NP;
+    const int jgp =  idx % NP;
+    compute_surface_bc(ie,igp,jgp);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagPostExchangeTiled&, const TeamMember &team) const {
+    const int ie_beg = team.league_rank()*m_tile_size;
+    const int ie_end = ie_beg+m_tile_size < m_num_elems ? ie_beg+m_tile_size : m_num_elems;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, (ie_end-ie_beg)*NP*NP),
+                         [&](const int idx) {
+      const int ie  = ie_beg + idx / (NP*NP);
+      const int igp = (idx / NP) % NP;
+      const int jgp =  idx % NP;
+      compute_surface_bc(ie,igp,jgp);
+    });
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void compute_surface_bc(const int ie, const int igp, const int jgp) const {
     // For g
     using namespace PhysicalConstants;
 
@@ -440,11 +502,6 @@ struct CaarFunctorImpl {
     constexpr int LAST_INT_PACK_END = InfoI::LastPackEnd;
 
     // Note: make sure you run this only in non-hydro mode
-    // KernelVariables kv(team);
-    const int ie  = idx / (NP*NP);
-    const int igp = (idx / NP) % NP;
-    const int jgp =  idx % NP;
-
     auto& u = m_state.m_v(ie,m_data.np1,0,igp,jgp,LAST_MID_PACK)[LAST_MID_PACK_END];
     auto& v = m_state.m_v(ie,m_data.np1,1,igp,jgp,LAST_MID_PACK)[LAST_MID_PACK_END];
     auto& w = m_state.m_w_i(ie,m_data.np1,igp,jgp,LAST_INT_PACK)[LAST_INT_PACK_END];
@@ -15,8 +15,8 @@
 
 namespace Homme {
 
-DirkFunctor::DirkFunctor (int nelem) {
-  m_dirk_impl.reset(new DirkFunctorImpl(nelem));
+DirkFunctor::DirkFunctor (int nelem, const bool modified_newton) {
+  m_dirk_impl.reset(new DirkFunctorImpl(nelem, modified_newton));
 }
 
 // Note: you cannot declare the default destructor in the header,
@@ -24,7 +24,11 @@ DirkFunctor::DirkFunctor (int nelem) {
 //       the unique ptr is pointing to, defying the pimpl idiom purpose.
 //       To fix this empasse, simply declare the destructor, and define
 //       it in the cpp file.
-DirkFunctor::~DirkFunctor () = default;
+DirkFunctor::~DirkFunctor () {
+  // Functors are destroyed when the Context is finalized, before the timers
+  // are printed.
+  if (Kokkos::is_initialized()) report_newton_counts();
+}
 
 int DirkFunctor::requested_buffer_size () const {
   return m_dirk_impl->requested_buffer_size();
@@ -41,4 +45,16 @@ void DirkFunctor::run (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int n
   GPTLstop("compute_stage_value_dirk");
 }
 
+void DirkFunctor::report_newton_counts () {
+  // Add the Newton iteration and Jacobian factorization counts, summed over
+  // elements, accumulated since the last report to the call counts of these
+  // timers.
+  int niter, nfactor;
+  m_dirk_impl->get_newton_counts(niter, nfactor);
+  GPTLstartstop_vals("DIRK Newton iterations", 0, niter - m_reported_counts[0]);
+  GPTLstartstop_vals("DIRK Jacobian factorizations", 0, nfactor - m_reported_counts[1]);
+  m_reported_counts[0] = niter;
+  m_reported_counts[1] = nfactor;
+}
+
 } // Namespace Homme
@@ -19,7 +19,9 @@ class HybridVCoord;
 
 class DirkFunctor {
 public:
-  DirkFunctor(const int nelem);
+  // If modified_newton, the Jacobian factorization is reused across Newton
+  // iterations and stages until the convergence rate degrades.
+  DirkFunctor(const int nelem, const bool modified_newton = false);
   DirkFunctor(const DirkFunctor &) = delete;
   DirkFunctor &operator=(const DirkFunctor &) = delete;
 
@@ -32,8 +34,14 @@ public:
   void run(int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
            const Elements& elements, const HybridVCoord& hvcoord);
 
+  // Report the Newton iteration and Jacobian factorization counts as GPTL
+  // timer call counts. The counts are kept on device by run, so this is the
+  // only place they are copied to host. Called at destruction.
+  void report_newton_counts();
+
 private:
   std::unique_ptr<DirkFunctorImpl> m_dirk_impl;
+  int m_reported_counts[2] = {0, 0};
 };
 
 } // Namespace Homme
@@ -32,6 +32,9 @@ struct DirkFunctorImpl {
   enum : int { num_phys_lev = NUM_PHYSICAL_LEV };
   enum : int { num_work = 12 };
   enum : bool { calc_initial_guess_in_newton_kernel = false };
+  // In modified Newton, the Jacobian is refactored if an iteration reduces the
+  // Newton increment by less than this factor.
+  static constexpr Real modified_newton_max_rate = 0.25;
 
   enum : int {
 #ifdef HOMMEXX_BFB_TESTING
@@ -65,6 +68,9 @@ struct DirkFunctorImpl {
     = Kokkos::View<Scalar    [num_phys_lev][npack],
                    Kokkos::LayoutRight, ExecSpace,
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using JacobianFactors
+    = Kokkos::View<Scalar*[3][num_phys_lev][npack],
+                   Kokkos::LayoutRight, ExecSpace>;
 
   KOKKOS_INLINE_FUNCTION
   static WorkSlot get_work_slot (const Work& w, const int& wi, const int& si) {
@@ -83,14 +89,37 @@ struct DirkFunctorImpl {
     return subview(w, wi, si, a, a);
   }
 
+  KOKKOS_INLINE_FUNCTION
+  static LinearSystemSlot get_jac_slot (const JacobianFactors& j, const int& ie,
+                                        const int& wi) {
+    using Kokkos::subview;
+    using Kokkos::ALL;
+    const auto a = ALL();
+    return subview(j, ie, wi, a, a);
+  }
+
   Work m_work;
   LinearSystem m_ls;
   TeamPolicy m_policy, m_ig_policy;
   TeamUtils<ExecSpace> m_tu, m_tu_ig;
   int nslot;
 
-  DirkFunctorImpl (const int nelem)
+  // In modified Newton, the LU factors of each element's Jacobian persist
+  // across Newton iterations and DIRK stages, so they can't live in the
+  // FunctorsBuffersManager buffers. m_jac_dt2(ie) is the dt2 element ie's
+  // factors were computed with, or 0 if there are none.
+  bool m_modified_newton;
+  JacobianFactors m_jac;
+  ExecViewManaged<Real*> m_jac_dt2;
+
+  // Running totals of Newton iterations and Jacobian factorizations over all
+  // elements and calls to run_newton. They stay on device, and are read only
+  // when they are reported, so run_newton does no host transfers.
+  ExecViewManaged<int[2]> m_newton_counts;
+
+  DirkFunctorImpl (const int nelem, const bool modified_newton = false)
     : m_policy(1,1,1), m_ig_policy(1,1,1), m_tu(m_policy), m_tu_ig(m_ig_policy) // throwaway settings
+    , m_modified_newton(modified_newton)
   {
     init(nelem);
   }
@@ -122,6 +151,18 @@ struct DirkFunctorImpl {
     nslot = std::min(nelem, m_tu.get_num_ws_slots());
     m_ig_policy = Homme::get_default_team_policy<ExecSpace>(nelem);
     m_tu_ig = TeamUtils<ExecSpace>(m_ig_policy);
+    if (m_modified_newton) {
+      m_jac = JacobianFactors("DIRK Jacobian factors", nelem);
+      m_jac_dt2 = ExecViewManaged<Real*>("DIRK Jacobian factors dt2", nelem);
+    }
+    m_newton_counts = ExecViewManaged<int[2]>("DIRK Newton counts");
+  }
+
+  void get_newton_counts (int& niter, int& nfactor) const {
+    const auto h = Kokkos::create_mirror_view(m_newton_counts);
+    Kokkos::deep_copy(h, m_newton_counts);
+    niter = h(0);
+    nfactor = h(1);
   }
 
   int requested_buffer_size () const {
@@ -216,6 +257,10 @@ struct DirkFunctorImpl {
 
     const auto work = m_work;
     const auto ls = m_ls;
+    const bool modified_newton = m_modified_newton;
+    const auto jac = m_jac;
+    const auto jac_dt2 = m_jac_dt2;
+    const auto newton_counts = m_newton_counts;
     const auto e_w_i = e.m_state.m_w_i;
     const auto e_vtheta_dp = e.m_state.m_vtheta_dp;
     const auto e_phinh_i = e.m_state.m_phinh_i;
@@ -250,6 +295,12 @@ struct DirkFunctorImpl {
       dl = get_ls_slot(ls, kv.team_idx, 0),
       d  = get_ls_slot(ls, kv.team_idx, 1),
       du = get_ls_slot(ls, kv.team_idx, 2);
+      LinearSystemSlot jdl, jd, jdu;
+      if (modified_newton) {
+        jdl = get_jac_slot(jac, ie, 0);
+        jd  = get_jac_slot(jac, ie, 1);
+        jdu = get_jac_slot(jac, ie, 2);
+      }
 
       // View of xfull for use in the solver. We want xfull so that we
       // can use the nlevp-1 entry, which we make sure is 0, when convenient.
@@ -339,8 +390,11 @@ struct DirkFunctorImpl {
 
       loop_ki(kv, nlev, nvec, [&] (int k, int i) { dphi_n0(k,i) = phi_n0(k+1,i) - phi_n0(k,i); });
 
-      int it = 0;
-      Real deltaerr;
+      int it = 0, nfactor = 0;
+      Real deltaerr, deltaerr_prev = 0;
+      // In modified Newton, reuse the element's factors from an earlier stage
+      // if they were computed with the same dt2.
+      bool have_jac = modified_newton && jac_dt2(ie) == dt2;
       for (; it < maxiter; ++it) { // Newton iteration
         const bool ok = pnh_and_exner_from_eos(kv, hvcoord, vtheta_dp, dp3d,
                                                dphi, pnh, wrk, dpnh_dp_i);
@@ -350,9 +404,22 @@ struct DirkFunctorImpl {
           x(k,i) = -(w_np1(k,i) - (w_n0(k,i) + grav*dt2*(dpnh_dp_i(k,i) - 1))); // -residual
         });
 
-        calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
-        kv.team_barrier();
-        if (bfb_solver) solvebfb(kv, dl, d, du, x); else solve(kv, dl, d, du, x);
+        if (modified_newton) {
+          if ( ! have_jac) {
+            calc_jacobian(kv, dt2, dp3d, dphi, pnh, jdl, jd, jdu);
+            kv.team_barrier();
+            if ( ! OnGpu<ExecSpace>::value) factor(kv, nvec, jdl, jd, jdu);
+            have_jac = true;
+            ++nfactor;
+          }
+          kv.team_barrier();
+          solve_stored(kv, nvec, jdl, jd, jdu, dl, d, du, x);
+        } else {
+          calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
+          kv.team_barrier();
+          if (bfb_solver) solvebfb(kv, dl, d, du, x); else solve(kv, dl, d, du, x);
+          ++nfactor;
+        }
         kv.team_barrier();
 
         loop_ki(kv, 1, nvec, [&] (int k, int i) { wrk(2,i) = 1; });
@@ -378,6 +445,12 @@ struct DirkFunctorImpl {
         loop_ki(kv, nlev, nvec, [&] (int k, int i) { w_np1(k,i) += wrk(2,i)*x(k,i); });
 
         if (exit_on_step(kv, nlev, nvec, wmax, deltatol, x, deltaerr)) break;
+
+        // Convergence-rate monitor: if the stored factors no longer give fast
+        // convergence, refactor at the current iterate.
+        if (modified_newton && it > 0 && deltaerr > modified_newton_max_rate*deltaerr_prev)
+          have_jac = false;
+        deltaerr_prev = deltaerr;
       } // Newton iteration
       kv.team_barrier();
 
@@ -387,6 +460,13 @@ struct DirkFunctorImpl {
         nerr = 1;
       }
 
+      Kokkos::single(Kokkos::PerTeam(kv.team), [&] () {
+        Kokkos::atomic_add(&newton_counts(0), it < maxiter ? it+1 : it);
+        Kokkos::atomic_add(&newton_counts(1), nfactor);
+        // Don't reuse factors that failed to give convergence.
+        if (modified_newton) jac_dt2(ie) = it < maxiter ? dt2 : 0;
+      });
+
       // Update phi_np1.
       loop_ki(kv, nlev, nvec, [&] (int k, int i) { phi_np1(k,i) = phi_n0(k,i) + dt2*grav*w_np1(k,i); });
 
@@ -787,6 +867,62 @@ struct DirkFunctorImpl {
     scream::tridiag::bfb(kv.team, dl, d, du, x);
   }
 
+  // Modified-Newton counterparts of solve. factor overwrites (dl, d, du) with
+  // the LU factors of the (diagonally dominant, see calc_jacobian) Jacobian,
+  // and solve_factored uses them to solve for x, so the factors can be reused
+  // for the following Newton iterations. The recurrences are serial in k, so
+  // they are used on CPU only; see solve_stored.
+  template <typename W>
+  KOKKOS_INLINE_FUNCTION
+  static void factor (const KernelVariables& kv, const int nvec,
+                      const W& dl, const W& d, const W& du) {
+    const int nlev = d.extent_int(0);
+    loop_ki(kv, 1, nvec, [&] (int, int i) {
+      for (int k = 1; k < nlev; ++k) {
+        dl(k,i) /= d(k-1,i);
+        d (k,i) -= dl(k,i)*du(k-1,i);
+      }
+    });
+  }
+
+  template <typename W, typename X>
+  KOKKOS_INLINE_FUNCTION
+  static void solve_factored (const KernelVariables& kv, const int nvec,
+                              const W& dl, const W& d, const W& du, const X& x) {
+    const int nlev = d.extent_int(0);
+    loop_ki(kv, 1, nvec, [&] (int, int i) {
+      for (int k = 1; k < nlev; ++k)
+        x(k,i) -= dl(k,i)*x(k-1,i);
+      x(nlev-1,i) /= d(nlev-1,i);
+      for (int k = nlev-1; k > 0; --k)
+        x(k-1,i) = (x(k-1,i) - du(k-1,i)*x(k,i))/d(k-1,i);
+    });
+  }
+
+  // Solve with an element's stored Jacobian (jdl, jd, jdu). On CPU these are
+  // the LU factors from factor. On GPU, a serial-in-k solve would leave most
+  // of the team idle, so the stored Jacobian is left unfactored, copied into
+  // the team's scratch system (dl, d, du), and solved with the parallel cyclic
+  // reduction solver. That still skips calc_jacobian on reuse.
+  template <typename W, typename X>
+  KOKKOS_INLINE_FUNCTION
+  static void solve_stored (const KernelVariables& kv, const int nvec,
+                            const W& jdl, const W& jd, const W& jdu,
+                            const W& dl, const W& d, const W& du, const X& x) {
+    if (OnGpu<ExecSpace>::value) {
+      const int nlev = d.extent_int(0);
+      loop_ki(kv, nlev, nvec, [&] (int k, int i) {
+        dl(k,i) = jdl(k,i);
+        d (k,i) = jd (k,i);
+        du(k,i) = jdu(k,i);
+      });
+      kv.team_barrier();
+      scream::tridiag::cr(kv.team, dl, d, du, x);
+    } else {
+      solve_factored(kv, nvec, jdl, jd, jdu, x);
+    }
+  }
+
   // Determine a step length 0 < alpha <= 1.
   KOKKOS_INLINE_FUNCTION static void
   calc_step_size (const KernelVariables& kv, const int nlev, const int nvec,
@@ -34,6 +34,9 @@ HyperviscosityFunctorImpl (const SimulationParams&     params,
  , m_policy_update_states (Homme::get_default_team_policy<ExecSpace,TagUpdateStates>(m_num_elems))
  , m_policy_first_laplace (Homme::get_default_team_policy<ExecSpace,TagFirstLaplaceHV>(m_num_elems))
  , m_policy_pre_exchange (Homme::get_default_team_policy<ExecSpace, TagHyperPreExchange>(m_num_elems))
+ , m_policy_second_laplace_const_pre_exchange (Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceConstHVPreExchange>(m_num_elems))
+ , m_policy_second_laplace_tensor_pre_exchange (Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceTensorHVPreExchange>(m_num_elems))
+ , m_policy_update_states_first_laplace (Homme::get_default_team_policy<ExecSpace,TagUpdateStatesFirstLaplaceHV>(m_num_elems))
  , m_policy_nutop_laplace (Homme::get_default_team_policy<ExecSpace, TagNutopLaplace>(m_num_elems))
  , m_policy_nutop_update_states (Homme::get_default_team_policy<ExecSpace,TagNutopUpdateStates>(m_num_elems))
  , m_tu(m_policy_update_states)
@@ -54,6 +57,9 @@ HyperviscosityFunctorImpl (const int num_elems, const SimulationParams &params)
   , m_policy_update_states (Homme::get_default_team_policy<ExecSpace,TagUpdateStates>(m_num_elems))
   , m_policy_first_laplace (Homme::get_default_team_policy<ExecSpace,TagFirstLaplaceHV>(m_num_elems))
   , m_policy_pre_exchange (Homme::get_default_team_policy<ExecSpace, TagHyperPreExchange>(m_num_elems))
+  , m_policy_second_laplace_const_pre_exchange (Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceConstHVPreExchange>(m_num_elems))
+  , m_policy_second_laplace_tensor_pre_exchange (Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceTensorHVPreExchange>(m_num_elems))
+  , m_policy_update_states_first_laplace (Homme::get_default_team_policy<ExecSpace,TagUpdateStatesFirstLaplaceHV>(m_num_elems))
   , m_policy_nutop_laplace (Homme::get_default_team_policy<ExecSpace, TagNutopLaplace>(m_num_elems))
   , m_policy_nutop_update_states (Homme::get_default_team_policy<ExecSpace,TagNutopUpdateStates>(m_num_elems))
   , m_tu(m_policy_update_states)
@@ -266,22 +272,40 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   });
   Kokkos::fence();
 
+  // This is biharmonic_wk_theta followed by the pre-exchange and update-states
+  // kernels, with element-local kernels that run back to back fused. The two
+  // exchanges per subcycle remain, as each consumes the previous Laplacian.
+  assert (m_be->is_registration_completed());
+  if (m_data.hypervis_subcycle > 0) {
+    Kokkos::parallel_for(m_policy_first_laplace, *this);
+    Kokkos::fence();
+  }
   for (int icycle = 0; icycle < m_data.hypervis_subcycle; ++icycle) {
     GPTLstart("hvf-bhwk");
-    biharmonic_wk_theta ();
-    GPTLstop("hvf-bhwk");
+    GPTLstart("hvf-bexch");
+    m_be->exchange(m_geometry.m_rspheremp);
+    GPTLstop("hvf-bexch");
 
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
+    // Second laplacian, then pre-exchange scaling
+    if (m_data.consthv) {
+      Kokkos::parallel_for(m_policy_second_laplace_const_pre_exchange, *this);
+    } else {
+      Kokkos::parallel_for(m_policy_second_laplace_tensor_pre_exchange, *this);
+    }
     Kokkos::fence();
+    GPTLstop("hvf-bhwk");
 
     // Exchange
-    assert (m_be->is_registration_completed());
     GPTLstart("hvf-bexch");
     m_be->exchange();
     GPTLstop("hvf-bexch");
 
-    // Update states
-    Kokkos::parallel_for(m_policy_update_states, *this);
+    // Update states, then the first laplacian of the next subcycle
+    if (icycle+1 < m_data.hypervis_subcycle) {
+      Kokkos::parallel_for(m_policy_update_states_first_laplace, *this);
+    } else {
+      Kokkos::parallel_for(m_policy_update_states, *this);
+    }
     Kokkos::fence();
   } //subcycle
 
@@ -85,6 +85,12 @@ public:
   struct TagHyperPreExchange {};
   struct TagNutopUpdateStates {};
   struct TagNutopLaplace {};
+  // Fused kernels used in run(). Each fuses element-local kernels that run
+  // back to back between two exchanges, saving a launch and a pass over the
+  // *tens buffers. The operations are the same, so results are BFB.
+  struct TagSecondLaplaceConstHVPreExchange {};
+  struct TagSecondLaplaceTensorHVPreExchange {};
+  struct TagUpdateStatesFirstLaplaceHV {};
 
   HyperviscosityFunctorImpl (const SimulationParams&     params,
                              const ElementsGeometry&     geometry,
@@ -384,6 +390,29 @@ public:
     });//parallel 4
   } //taghyperpreexchange
 
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagSecondLaplaceConstHVPreExchange&, const TeamMember& team) const {
+    operator()(TagSecondLaplaceConstHV(), team);
+    team.team_barrier();
+    operator()(TagHyperPreExchange(), team);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagSecondLaplaceTensorHVPreExchange&, const TeamMember& team) const {
+    operator()(TagSecondLaplaceTensorHV(), team);
+    team.team_barrier();
+    operator()(TagHyperPreExchange(), team);
+  }
+
+  // State update at the end of one subcycle, then the first Laplacian of the
+  // next one.
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagUpdateStatesFirstLaplaceHV&, const TeamMember& team) const {
+    operator()(TagUpdateStates(), team);
+    team.team_barrier();
+    operator()(TagFirstLaplaceHV(), team);
+  }
+
 protected:
 
   const int             m_num_elems;
@@ -403,6 +432,9 @@ protected:
   Kokkos::TeamPolicy<ExecSpace,TagUpdateStates>     m_policy_update_states;
   Kokkos::TeamPolicy<ExecSpace,TagFirstLaplaceHV>   m_policy_first_laplace;
   Kokkos::TeamPolicy<ExecSpace,TagHyperPreExchange> m_policy_pre_exchange;
+  Kokkos::TeamPolicy<ExecSpace,TagSecondLaplaceConstHVPreExchange>  m_policy_second_laplace_const_pre_exchange;
+  Kokkos::TeamPolicy<ExecSpace,TagSecondLaplaceTensorHVPreExchange> m_policy_second_laplace_tensor_pre_exchange;
+  Kokkos::TeamPolicy<ExecSpace,TagUpdateStatesFirstLaplaceHV>       m_policy_update_states_first_laplace;
 
   Kokkos::TeamPolicy<ExecSpace,TagNutopLaplace>      m_policy_nutop_laplace;
   Kokkos::TeamPolicy<ExecSpace,TagNutopUpdateStates> m_policy_nutop_update_states;
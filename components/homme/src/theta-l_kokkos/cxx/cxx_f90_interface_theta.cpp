@@ -47,7 +47,8 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
                                const bool& use_cpstar, const int& transport_alg, const bool& theta_hydrostatic_mode, const char** test_case,
                                const int& dt_remap_factor, const int& dt_tracer_factor,
                                const double& scale_factor, const double& laplacian_rigid_factor, const int& nsplit, const bool& pgrad_correction,
-                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level)
+                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level,
+                               const bool& dirk_modified_newton)
 {
   // Check that the simulation options are supported. This helps us in the future, since we
   // are currently 'assuming' some option have/not have certain values. As we support for more
@@ -124,6 +125,7 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
   params.dp3d_thresh                   = dp3d_thresh;
   params.vtheta_thresh                 = vtheta_thresh;
   params.internal_diagnostics_level    = internal_diagnostics_level;
+  params.dirk_modified_newton          = dirk_modified_newton;
 
   if (time_step_type==5) {
     //5 stage, 3rd order, explicit
@@ -397,7 +399,7 @@ void init_functors_c (const bool& allocate_buffer)
 
   if (need_dirk) {
     // Create dirk functor only if needed
-    c.create_if_not_there<DirkFunctor>(elems.num_elems());
+    c.create_if_not_there<DirkFunctor>(elems.num_elems(), params.dirk_modified_newton);
   }
 
   // If memory in the buffer manager was previously allocated, skip allocation here
@@ -82,4 +82,25 @@ TEST_CASE("remap_interface", "vertical remap") {
     RF remap(qsize, elements, tracers, hvcoord);
     REQUIRE_NOTHROW(remap.run_remap(np1, n0_qdp, dt));
   }
+  SECTION("states_tracers_limited_extrap") {
+    constexpr bool rsplit_non_zero = true;
+    constexpr int qsize = QSIZE_D;
+    using RF = RemapFunctor<rsplit_non_zero, PpmVertRemap<PpmLimitedExtrap>>;
+    RF remap(qsize, elements, tracers, hvcoord);
+    REQUIRE_NOTHROW(remap.run_remap(np1, n0_qdp, dt));
+  }
+  SECTION("fields_per_team") {
+    // Batching fields must never leave fewer teams than either the number of
+    // (element, field) pairs or the available concurrency, whatever the
+    // number of fields remapped.
+    using RF = RemapFunctor<true, PpmVertRemap<PpmMirrored>>;
+    const int concurrency = ExecSpace::concurrency();
+    for (const int nv : {1, 2, 3, 5, QSIZE_D, 40}) {
+      const int nf = RF::fields_per_team(num_elems, nv);
+      REQUIRE(nf >= 1);
+      REQUIRE(nf <= nv);
+      const int nteams = num_elems*RF::num_batches(nv, nf);
+      REQUIRE(nteams >= std::min(num_elems*nv, concurrency));
+    }
+  }
 }
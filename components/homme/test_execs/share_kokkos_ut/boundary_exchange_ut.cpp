@@ -301,6 +301,80 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
     }}}}}}
   }
 
+#if HOMMEXX_MPI_SHARED_NODE
+  // The shared-memory node window must be BFB with plain messages: exchange the
+  // same fields once through each, with their own buffers managers.
+  if (MpiBuffersManager::node_window_supported) {
+    auto bm_msg     = std::make_shared<MpiBuffersManager>(connectivity);
+    auto bm_msg_mm  = std::make_shared<MpiBuffersManager>(connectivity);
+    auto bm_node    = std::make_shared<MpiBuffersManager>(connectivity);
+    auto bm_node_mm = std::make_shared<MpiBuffersManager>(connectivity);
+    bm_msg->set_use_node_window(false);
+    bm_msg_mm->set_use_node_window(false);
+    REQUIRE(bm_node->use_node_window());
+
+    ExecViewManaged<Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV]> f3d_msg ("", num_elements), f3d_node("", num_elements);
+    ExecViewManaged<Scalar*[num_min_max_fields_1d][2][NUM_LEV]> f1d_msg ("", num_elements), f1d_node("", num_elements);
+    Kokkos::deep_copy(f3d_msg,  field_3d_cxx);
+    Kokkos::deep_copy(f3d_node, field_3d_cxx);
+    Kokkos::deep_copy(f1d_msg,  field_1d_cxx);
+    Kokkos::deep_copy(f1d_node, field_1d_cxx);
+
+    auto be_msg     = std::make_shared<BoundaryExchange>(connectivity,bm_msg);
+    auto be_msg_mm  = std::make_shared<BoundaryExchange>(connectivity,bm_msg_mm);
+    auto be_node    = std::make_shared<BoundaryExchange>(connectivity,bm_node);
+    auto be_node_mm = std::make_shared<BoundaryExchange>(connectivity,bm_node_mm);
+    for (auto be : {be_msg, be_node}) {
+      be->set_num_fields(0,0,num_scalar_fields_3d);
+    }
+    be_msg->register_field(f3d_msg,1,field_3d_idim);
+    be_node->register_field(f3d_node,1,field_3d_idim);
+    for (auto be : {be_msg_mm, be_node_mm}) {
+      be->set_num_fields(num_min_max_fields_1d,0,0);
+    }
+    be_msg_mm->register_min_max_fields(f1d_msg,num_min_max_fields_1d,0);
+    be_node_mm->register_min_max_fields(f1d_node,num_min_max_fields_1d,0);
+    for (auto be : {be_msg, be_node, be_msg_mm, be_node_mm}) {
+      be->registration_completed();
+    }
+
+    // Exchange twice, so the second exchange reuses buffers that were read by
+    // the neighbors during the first one.
+    for (int rep=0; rep<2; ++rep) {
+      be_msg->exchange();
+      be_node->exchange();
+      be_msg_mm->exchange_min_max();
+      be_node_mm->exchange_min_max();
+    }
+
+    auto f3d_msg_h  = Kokkos::create_mirror_view(f3d_msg);
+    auto f3d_node_h = Kokkos::create_mirror_view(f3d_node);
+    auto f1d_msg_h  = Kokkos::create_mirror_view(f1d_msg);
+    auto f1d_node_h = Kokkos::create_mirror_view(f1d_node);
+    Kokkos::deep_copy(f3d_msg_h,  f3d_msg);
+    Kokkos::deep_copy(f3d_node_h, f3d_node);
+    Kokkos::deep_copy(f1d_msg_h,  f1d_msg);
+    Kokkos::deep_copy(f1d_node_h, f1d_node);
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int ilev=0; ilev<NUM_LEV; ++ilev) {
+        for (int ivec=0; ivec<VECTOR_SIZE; ++ivec) {
+          for (int itl=0; itl<NUM_TIME_LEVELS; ++itl) {
+            for (int igp=0; igp<NP; ++igp) {
+              for (int jgp=0; jgp<NP; ++jgp) {
+                REQUIRE(f3d_msg_h(ie,itl,igp,jgp,ilev)[ivec] == f3d_node_h(ie,itl,igp,jgp,ilev)[ivec]);
+          }}}
+          for (int ifield=0; ifield<num_min_max_fields_1d; ++ifield) {
+            REQUIRE(f1d_msg_h(ie,ifield,MIN_ID,ilev)[ivec] == f1d_node_h(ie,ifield,MIN_ID,ilev)[ivec]);
+            REQUIRE(f1d_msg_h(ie,ifield,MAX_ID,ilev)[ivec] == f1d_node_h(ie,ifield,MAX_ID,ilev)[ivec]);
+          }
+    }}}
+
+    for (auto be : {be_msg, be_node, be_msg_mm, be_node_mm}) {
+      be->clean_up();
+    }
+  }
+#endif
+
   // Cleanup
   cleanup_f90();  // Deallocate stuff in the F90 module
   be1->clean_up();
@@ -13,8 +13,11 @@
 #include "utilities/Hash.hpp"
 
 #include "HybridVCoord.hpp"
+#include "mpi/SfcPartitioner.hpp"
 
 #include <random>
+#include <vector>
+#include <cmath>
 
 using namespace Homme;
 
@@ -563,3 +566,72 @@ TEST_CASE("hasher", "hasher") {
   testeq<float>();
   testeq<double>(); 
 }
+
+TEST_CASE("sfc_partitioner", "sfc_partitioner") {
+  // Doubly periodic n x n grid with 8 neighbors per vertex, embedded as a
+  // torus in 3D so the coordinates have no wrap-around seam.
+  const int n = 24, nvtx = n*n;
+  std::vector<int> xadj(nvtx+1), adjncy;
+  std::vector<double> adjwgt, x(nvtx), y(nvtx), z(nvtx);
+  for (int j = 0; j < n; ++j)
+    for (int i = 0; i < n; ++i) {
+      const int v = j*n + i;
+      const double a = 2*M_PI*i/n, b = 2*M_PI*j/n;
+      x[v] = (2 + std::cos(b))*std::cos(a);
+      y[v] = (2 + std::cos(b))*std::sin(a);
+      z[v] = std::sin(b);
+      xadj[v] = adjncy.size();
+      for (int dj = -1; dj <= 1; ++dj)
+        for (int di = -1; di <= 1; ++di) {
+          if (di == 0 && dj == 0) continue;
+          adjncy.push_back(((j + dj + n) % n)*n + (i + di + n) % n);
+          adjwgt.push_back(di != 0 && dj != 0 ? 1 : 4);
+        }
+    }
+  xadj[nvtx] = adjncy.size();
+
+  const auto run = [&] (SfcPartitionParams p, const double* vwgt, std::vector<int>& part) {
+    part.resize(nvtx);
+    sfc_partition(nvtx, xadj.data(), adjncy.data(), adjwgt.data(), vwgt,
+                  x.data(), y.data(), z.data(), p, part.data());
+    std::vector<int> cnt(p.nparts, 0);
+    for (const int e : part) {
+      REQUIRE(e >= 0);
+      REQUIRE(e < p.nparts);
+      ++cnt[e];
+    }
+    for (const int c : cnt) REQUIRE(c >= 1);
+    return compute_partition_metrics(nvtx, xadj.data(), adjncy.data(), adjwgt.data(),
+                                     vwgt, p, part.data());
+  };
+
+  for (const int nparts : {1, 5, 64, nvtx/2, nvtx}) {
+    SfcPartitionParams p;
+    p.nparts = nparts;
+    p.parts_per_node = 4;
+    p.refine_passes = 0;
+    std::vector<int> part0, part1, part2;
+    const auto m0 = run(p, nullptr, part0);
+    // The SFC cut is balanced to within one element.
+    REQUIRE(m0.max_load <= std::ceil(m0.avg_load));
+    p.refine_passes = 4;
+    const auto m1 = run(p, nullptr, part1);
+    // Refinement never increases the max load or the communication cost.
+    REQUIRE(m1.max_load <= std::max(p.imbalance_tol*m1.avg_load, m0.max_load));
+    REQUIRE(m1.edge_cut + (p.off_node_factor - 1)*m1.off_node_edge_cut <=
+            m0.edge_cut + (p.off_node_factor - 1)*m0.off_node_edge_cut);
+    // Deterministic.
+    run(p, nullptr, part2);
+    REQUIRE(part1 == part2);
+  }
+
+  { // Weighted: a block of expensive elements must be spread out.
+    std::vector<double> vwgt(nvtx, 1);
+    for (int i = 0; i < nvtx/8; ++i) vwgt[i] = 8;
+    SfcPartitionParams p;
+    p.nparts = 16;
+    std::vector<int> part;
+    const auto m = run(p, vwgt.data(), part);
+    REQUIRE(m.max_load <= m.avg_load + 8);
+  }
+}
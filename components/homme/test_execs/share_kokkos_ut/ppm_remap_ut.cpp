@@ -286,7 +286,10 @@ public:
         generate_grid_intervals(engine, top, "kokkos target layer thickness");
   }
 
-  void test_remap() {
+  // If batched, each team remaps all fields of its element in one call to
+  // compute_remap_phase.
+  void test_remap(const bool batched = false) {
+    remap_batched = batched;
     std::random_device rd;
     const unsigned int catchRngSeed = Catch::rngSeed();
     const unsigned int seed = catchRngSeed==0 ? rd() : catchRngSeed;
@@ -370,12 +373,18 @@ public:
     remap.compute_grids_phase(
         kv, Homme::subview(src_layer_thickness_kokkos, kv.ie),
         Homme::subview(tgt_layer_thickness_kokkos, kv.ie));
-    for (int var = 0; var < num_remap; ++var) {
-      remap.compute_remap_phase(kv, Homme::subview(remap_vals, kv.ie, var));
+    if (remap_batched) {
+      remap.compute_remap_phase(
+        kv, num_remap, [&] (const int var) { return Homme::subview(remap_vals, kv.ie, var); });
+    } else {
+      for (int var = 0; var < num_remap; ++var) {
+        remap.compute_remap_phase(kv, Homme::subview(remap_vals, kv.ie, var));
+      }
     }
   }
 
   const int ne, num_remap;
+  bool remap_batched = false;
   PpmVertRemap<boundary_cond> remap;
   ExecViewManaged<Scalar * [NP][NP][NUM_LEV]> src_layer_thickness_kokkos;
   ExecViewManaged<Scalar * [NP][NP][NUM_LEV]> tgt_layer_thickness_kokkos;
@@ -389,6 +398,15 @@ TEST_CASE("ppm_mirrored", "vertical remap") {
   SECTION("grid") { remap_test_mirrored.test_grid(); }
   SECTION("ppm") { remap_test_mirrored.test_ppm(); }
   SECTION("remap") { remap_test_mirrored.test_remap(); }
+  SECTION("remap_batched") { remap_test_mirrored.test_remap(true); }
+}
+
+TEST_CASE("ppm_limited_extrap", "vertical remap") {
+  constexpr int num_elems = 2;
+  constexpr int num_remap = 5;
+  ppm_remap_functor_test<PpmLimitedExtrap> remap_test_extrap(num_elems, num_remap);
+  SECTION("remap") { remap_test_extrap.test_remap(); }
+  SECTION("remap_batched") { remap_test_extrap.test_remap(true); }
 }
 
 
@@ -1,4 +1,5 @@
 #include "ComposeTransport.hpp"
+#include "EulerStepFunctorImpl.hpp"
 #include "compose_test.hpp"
 
 #include "Types.hpp"
@@ -27,6 +28,7 @@
 #include "utilities/ViewUtils.hpp"
 
 #include <catch2/catch.hpp>
+#include <cstring>
 #include <random>
 
 using namespace Homme;
@@ -37,13 +39,16 @@ extern char** hommexx_catch2_argv;
 extern "C" {
   void init_compose_f90(int ne, const Real* hyai, const Real* hybi, const Real* hyam,
                         const Real* hybm, Real ps0, Real* dvv, Real* mp, int qsize,
-                        int hv_q, int limiter_option, bool cdr_check, bool is_sphere);
+                        int hv_q, int limiter_option, bool cdr_check, bool is_sphere,
+                        int halo);
   void init_geometry_f90();
   void cleanup_compose_f90();
   void run_compose_standalone_test_f90(int* nmax, Real* eval);
   void run_trajectory_f90(Real t0, Real t1, bool independent_time_steps, Real* dep,
                           Real* dprecon);
   void run_sl_vertical_remap_bfb_f90(Real* diagnostic);
+  void slmm_set_track_dep_stats(bool track);
+  void slmm_get_dep_stats(int* nexchange, int* max_layer, int* nnearest);
 } // extern "C"
 
 using CA4d = Kokkos::View<Real****, Kokkos::LayoutRight, Kokkos::HostSpace>;
@@ -99,7 +104,7 @@ void fill (Random& r, const V& a,
 }
 
 struct Session {
-  int ne, hv_q;
+  int ne, hv_q, halo;
   bool cdr_check, is_sphere;
   HybridVCoord h;
   Random r;
@@ -145,7 +150,7 @@ struct Session {
     std::vector<Real> dvv(NP*NP), mp(NP*NP);
     init_compose_f90(ne, hyai.data(), hybi.data(), &hyam(0)[0], &hybm(0)[0], h.ps0,
                      dvv.data(), mp.data(), qsize, hv_q, p.limiter_option, cdr_check,
-                     is_sphere);
+                     is_sphere, halo);
     ref_FE.init_mass(mp.data());
     ref_FE.init_deriv(dvv.data());
 
@@ -201,12 +206,13 @@ struct Session {
 private:
   static std::shared_ptr<Session> s_session;
 
-  // compose_ut hommexx -ne NE -qsize QSIZE -hvq HV_Q -cdrcheck
+  // compose_ut hommexx -ne NE -qsize QSIZE -hvq HV_Q -halo HALO -cdrcheck
   void parse_command_line () {
     const bool am_root = get_comm().root();
     ne = 2;
     qsize = QSIZE_D;
     hv_q = 1;
+    halo = 2;
     cdr_check = false;
     is_sphere = true;
     bool ok = true;
@@ -222,6 +228,9 @@ private:
       } else if (tok == "-hvq") {
         if (i+1 == hommexx_catch2_argc) { ok = false; break; }
         hv_q = std::atoi(hommexx_catch2_argv[++i]);
+      } else if (tok == "-halo") {
+        if (i+1 == hommexx_catch2_argc) { ok = false; break; }
+        halo = std::atoi(hommexx_catch2_argv[++i]);
       } else if (tok == "-cdrcheck") {
         cdr_check = true;
       } else if (tok == "-planar") {
@@ -231,6 +240,7 @@ private:
     ne = std::max(2, std::min(128, ne));
     qsize = std::max(1, std::min(QSIZE_D, qsize));
     hv_q = std::max(0, std::min(qsize, hv_q));
+    halo = std::max(1, std::min(4, halo));
     if ( ! ok && am_root)
       printf("compose_ut> Failed to parse command line, starting with: %s\n",
              hommexx_catch2_argv[i]);
@@ -241,14 +251,23 @@ private:
 #else
         0;
 #endif
-      printf("compose_ut> bfb %d ne %d qsize %d hv_q %d cdr_check %d\n",
-             bfb, ne, qsize, hv_q, cdr_check ? 1 : 0);
+      printf("compose_ut> bfb %d ne %d qsize %d hv_q %d halo %d cdr_check %d\n",
+             bfb, ne, qsize, hv_q, halo, cdr_check ? 1 : 0);
     }
   }
 };
 
 std::shared_ptr<Session> Session::s_session;
 
+template <typename V>
+void fill_range (Random& r, const V& a, const Real lo, const Real hi) {
+  const auto am = cmvdc(a);
+  Real* const p = pack2real(am);
+  const size_t n = am.size()*VECTOR_SIZE;
+  for (size_t i = 0; i < n; ++i) p[i] = r.urrng(lo, hi);
+  deep_copy(a, am);
+}
+
 static bool almost_equal (const Real& a, const Real& b,
                           const Real tol = 0) {
   const auto re = std::abs(a-b)/(1 + std::abs(a));
@@ -386,7 +405,7 @@ TEST_CASE ("compose_transport_testing") {
   }
 
   { // 2D SL BFB
-    int nmax;
+    int nmax = 0;
     std::vector<Real> eval_f((s.nlev+1)*s.qsize), eval_c(eval_f.size());
     run_compose_standalone_test_f90(&nmax, eval_f.data());
     for (const bool bfb : {false, true}) {
@@ -409,6 +428,79 @@ TEST_CASE ("compose_transport_testing") {
     }
   }
 
+  { // SL substeps: nsubstep forced substeps per step match plain steps of the
+    // substep length, leave vn0 alone, and the Courant number scales with dt.
+    // The substep length matches the 12*ne steps of the halo test below.
+    REQUIRE(ct.test_substeps(6*s.ne, 2) == 0);
+  }
+
+  { // SL halo width vs number of exchange rounds
+    // Every tracer step does one departure point/q exchange round. Run the 2D
+    // SL test over the same simulated time with decreasing numbers of steps,
+    // and record the halo layer each run needs, i.e., the outermost layer in
+    // which a departure point is found, or halo+1 if any departure point left
+    // the halo. The fewest steps, thus exchange rounds, a run with a halo of
+    // h layers needs must decrease with h.
+    const int halo = s.halo;
+    std::vector<int> nsteps;
+    for (const int f : {12, 10, 8, 6, 5, 4, 3, 2}) nsteps.push_back(f*s.ne);
+    std::vector<Real> eval((s.nlev+1)*s.qsize);
+    std::vector<int> min_nsteps(halo+1, nsteps[0] + 1);
+    for (int nmax : nsteps) {
+      slmm_set_track_dep_stats(true);
+      run_compose_standalone_test_f90(&nmax, eval.data());
+      int lcl[3], gbl[3];
+      slmm_get_dep_stats(&lcl[0], &lcl[1], &lcl[2]);
+      slmm_set_track_dep_stats(false);
+      MPI_Allreduce(lcl, gbl, 3, MPI_INT, MPI_MAX, s.get_comm().mpi_comm());
+      REQUIRE(gbl[0] == nmax);
+      const int needed = gbl[2] > 0 ? halo+1 : gbl[1];
+      if (s.get_comm().root())
+        printf("compose_ut> halo %d nsteps %3d exchange rounds %3d needs halo %d\n",
+               halo, nmax, gbl[0], needed);
+      for (int h = needed; h <= halo; ++h) min_nsteps[h] = nmax;
+    }
+    REQUIRE(min_nsteps[halo] <= nsteps[0]);
+    if (halo > 1) REQUIRE(min_nsteps[halo] < min_nsteps[halo-1]);
+  }
+
+  { // Euler step with and without packing qdp into the DSS send buffers from
+    // the tracer phase must be BFB.
+    auto& c = Context::singleton();
+    const auto& t = c.get<Tracers>();
+    const auto& d = s.e->m_derived;
+    EulerStepFunctorImpl esf;
+    esf.reset(c.get<SimulationParams>());
+    FunctorsBuffersManager esf_fbm;
+    esf_fbm.request_size(esf.requested_buffer_size());
+    esf_fbm.allocate();
+    esf.init_buffers(esf_fbm);
+    esf.init_boundary_exchanges();
+
+    fill_range(s.r, t.qdp, 0.5, 1.5);
+    fill_range(s.r, d.m_dp, 0.5, 1.5);
+    fill_range(s.r, d.m_vn0, -10, 10);
+    fill_range(s.r, d.m_divdp, -1e-6, 1e-6);
+    fill_range(s.r, d.m_divdp_proj, -1e-6, 1e-6);
+    fill_range(s.r, d.m_eta_dot_dpdn, -1e-6, 1e-6);
+    fill_range(s.r, d.m_omega_p, -1e-6, 1e-6);
+    const auto qdp0 = Kokkos::create_mirror(t.qdp);
+    deep_copy(qdp0, t.qdp);
+
+    decltype(qdp0) qdp[2];
+    for (const bool fuse : {false, true}) {
+      deep_copy(t.qdp, qdp0);
+      esf.set_fuse_dss_pack(fuse);
+      // Fresh q bounds, then reused ones, with two different DSS variables.
+      esf.euler_step(1, 0, 60, 0, DSSOption::DIV_VDP_AVE);
+      esf.euler_step(0, 1, 60, 1, DSSOption::ETA);
+      qdp[fuse] = Kokkos::create_mirror(t.qdp);
+      deep_copy(qdp[fuse], t.qdp);
+    }
+    REQUIRE(std::memcmp(qdp[0].data(), qdp[1].data(),
+                        qdp[0].size()*sizeof(Scalar)) == 0);
+  }
+
   } catch (...) {}
   Session::delete_singleton();
 }
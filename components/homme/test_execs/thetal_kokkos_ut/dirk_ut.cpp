@@ -693,6 +693,17 @@ TEST_CASE ("dirk_toplevel_testing") {
   FunctorsBuffersManager fbm;
   init(d, fbm);
 
+  // Modified Newton. It is reused across the cases below, so stored Jacobian
+  // factors from one case are used as the starting point of the next.
+  DirkFunctorImpl dmn(nelemd, true /* modified Newton */);
+  FunctorsBuffersManager fbmmn;
+  init(dmn, fbmmn);
+#ifdef HOMMEXX_BFB_TESTING
+  const Real mn_tol = 1e-4;
+#else
+  const Real mn_tol = 1e8*eps;
+#endif
+
   { // Test initial guess function.
     init_elems(ne, nelemd, r, hvcoord, e);
     { // C++ version with DIRK-newton-loop policy.
@@ -762,9 +773,13 @@ TEST_CASE ("dirk_toplevel_testing") {
     const int nm1 = alphadtwt_nm1 == 0.0 ? -1 : 0;
     for (Real alphadtwt_n0 : {0.0, 0.7}) {
       decltype(ElementsState::m_w_i) w_i("w_i", nelemd),
-        w_i1("w_i1", nelemd), w_i2("w_i2", nelemd);
+        w_i1("w_i1", nelemd), w_i2("w_i2", nelemd), w_i3("w_i3", nelemd);
       decltype(ElementsState::m_phinh_i) phinh_i("phinh_i", nelemd),
-        phinh_i1("phinh_i1", nelemd), phinh_i2("phinh_i2", nelemd);
+        phinh_i1("phinh_i1", nelemd), phinh_i2("phinh_i2", nelemd),
+        phinh_i3("phinh_i3", nelemd);
+
+      // Newton counts of the modified-Newton run of this case.
+      int niter_mn = 0, nfactor_mn = 0;
 
       bool good = false;
       for (int trial = 0; trial < 100 /* don't enter an inf loop */; ++trial) {
@@ -827,6 +842,21 @@ TEST_CASE ("dirk_toplevel_testing") {
         deep_copy(e.m_state.m_w_i, w_i);
         deep_copy(e.m_state.m_phinh_i, phinh_i);
 
+        // Run C++ with modified Newton.
+        int niter0, nfactor0;
+        dmn.get_newton_counts(niter0, nfactor0);
+        dmn.run(nm1, alphadtwt_nm1*dt2, n0, alphadtwt_n0*dt2, np1, dt2,
+                e, hvcoord, false /* non-BFB solver */);
+        fence();
+        dmn.get_newton_counts(niter_mn, nfactor_mn);
+        niter_mn -= niter0;
+        nfactor_mn -= nfactor0;
+        deep_copy(w_i3, e.m_state.m_w_i);
+        deep_copy(phinh_i3, e.m_state.m_phinh_i);
+        // Restore state.
+        deep_copy(e.m_state.m_w_i, w_i);
+        deep_copy(e.m_state.m_phinh_i, phinh_i);
+
         break;
       }
 
@@ -848,6 +878,25 @@ TEST_CASE ("dirk_toplevel_testing") {
                 REQUIRE(almost_equal(p1[k], p2[k], 1e6*eps));
             }
 
+      // Test that modified Newton converges to the same solution.
+      {
+        const auto w3m = cmvdc(w_i3);
+        const auto phinh3m = cmvdc(phinh_i3);
+        for (int ie = 0; ie < nelemd; ++ie)
+          for (int i = 0; i < np; ++i)
+            for (int j = 0; j < np; ++j)
+              for (int f = 0; f < 2; ++f) {
+                Real* p2 = f == 0 ? &w2m(ie,np1,i,j,0)[0] : &phinh2m(ie,np1,i,j,0)[0];
+                Real* p3 = f == 0 ? &w3m(ie,np1,i,j,0)[0] : &phinh3m(ie,np1,i,j,0)[0];
+                for (int k = 0; k < nlev+1; ++k)
+                  REQUIRE(almost_equal(p2[k], p3[k], mn_tol));
+              }
+        // Test that the Jacobian factors were reused: fewer factorizations
+        // than Newton iterations in this run.
+        REQUIRE(niter_mn > 0);
+        REQUIRE(nfactor_mn < niter_mn);
+      }
+
       // Run F90 with BFB solver.
       c2f(e);
       compute_stage_value_dirk_f90(nm1+1, alphadtwt_nm1*dt2, n0+1, alphadtwt_n0*dt2, np1+1, dt2);
@@ -0,0 +1,502 @@
+#include <catch2/catch.hpp>
+
+#include <limits>
+#include <random>
+
+#include "Types.hpp"
+#include "Context.hpp"
+#include "CaarFunctorImpl.hpp"
+#include "DirkFunctorImpl.hpp"
+#include "FunctorsBuffersManager.hpp"
+#include "HyperviscosityFunctorImpl.hpp"
+#include "VerticalRemapManager.hpp"
+#include "SimulationParams.hpp"
+#include "Elements.hpp"
+#include "HybridVCoord.hpp"
+#include "Tracers.hpp"
+#include "PhysicalConstants.hpp"
+#include "mpi/Comm.hpp"
+#include "mpi/Connectivity.hpp"
+
+#include "utilities/TestUtils.hpp"
+#include "utilities/SyncUtils.hpp"
+#include "utilities/ViewUtils.hpp"
+
+// Standalone timings of the theta-l functors, on the same randomized state the
+// unit tests use. Nothing is compared against Fortran; F90 is only used to
+// build the mesh and geometry. Run as
+//   thetal_kokkos_bench hommexx [-ne NE] [-nrep N] [-qsize Q] [-hvsub S]
+//                               [-peak-gflops G] [-peak-gbs B]
+// The thread count is whatever Kokkos was initialized with (e.g.,
+// OMP_NUM_THREADS or --kokkos-num-threads). NUM_LEV is fixed at build time by
+// HOMMEXX_UT_NUM_PLEV.
+
+using namespace Homme;
+
+extern int hommexx_catch2_argc;
+extern char** hommexx_catch2_argv;
+
+extern "C" {
+void init_caar_f90 (const int& ne,
+               const Real* hyai_ptr, const Real* hybi_ptr,
+               const Real* hyam_ptr, const Real* hybm_ptr,
+               Real* dvv, Real* mp,
+               const Real& ps0);
+void init_geo_views_f90 (Real*& d_ptr,Real*& dinv_ptr,
+               const Real*& phis_ptr, const Real*& gradphis_ptr,
+               Real*& fcor_ptr,
+               Real*& sphmp_ptr, Real*& rspmp_ptr,
+               Real*& tVisc_ptr, Real*& sph2c_ptr,
+               Real*& metdet_ptr, Real*& metinv_ptr);
+void cleanup_f90();
+} // extern "C"
+
+namespace {
+
+struct BenchOptions {
+  int ne, nrep, qsize, hvsub;
+  // If > 0, report each kernel's rate as a fraction of the roofline bound
+  // min(peak_gflops, intensity*peak_gbs).
+  Real peak_gflops, peak_gbs;
+
+  void parse_command_line (const bool am_root) {
+    ne = 4;
+    nrep = 10;
+    qsize = QSIZE_D;
+    hvsub = 1;
+    peak_gflops = peak_gbs = 0;
+    bool ok = true;
+    int i;
+    for (i = 0; i < hommexx_catch2_argc; ++i) {
+      const std::string tok(hommexx_catch2_argv[i]);
+      if (i+1 == hommexx_catch2_argc) { ok = false; break; }
+      if (tok == "-ne") {
+        ne = std::atoi(hommexx_catch2_argv[++i]);
+      } else if (tok == "-nrep") {
+        nrep = std::atoi(hommexx_catch2_argv[++i]);
+      } else if (tok == "-qsize") {
+        qsize = std::atoi(hommexx_catch2_argv[++i]);
+      } else if (tok == "-hvsub") {
+        hvsub = std::atoi(hommexx_catch2_argv[++i]);
+      } else if (tok == "-peak-gflops") {
+        peak_gflops = std::atof(hommexx_catch2_argv[++i]);
+      } else if (tok == "-peak-gbs") {
+        peak_gbs = std::atof(hommexx_catch2_argv[++i]);
+      } else {
+        ok = false;
+        break;
+      }
+    }
+    ne = std::max(2, ne);
+    nrep = std::max(1, nrep);
+    qsize = std::max(1, std::min(QSIZE_D, qsize));
+    hvsub = std::max(1, hvsub);
+    if ( ! ok && am_root)
+      printf("kernel_bench> Failed to parse command line, starting with: %s\n",
+             hommexx_catch2_argv[i]);
+  }
+};
+
+// Nominal cost of one functor call per (element, GLL point, physical level).
+// flops are hand counts from the kernels' source, with the configuration set
+// up below (nonhydrostatic, conservative theta advection, rsplit>0, constant
+// coefficient HV); a divide, pow, or log counts as one flop. bytes count each
+// level-resolved field read or written once, i.e. the compulsory traffic,
+// with a boundary exchange counted as a read of each field to pack it and a
+// read and write to unpack it. Both are approximate, and are meant for
+// comparing builds and nodes, not for absolute claims. Update them when the
+// kernels change.
+struct KernelCost {
+  Real flops;
+  Real fields_moved;
+};
+
+// SphereOperators, per point and level of the output. Each derivative is an
+// NP-term dot product with dvv, i.e. 2*NP flops.
+//   gradient_sphere: 2 derivatives, 2 scalings, D^-1 times the result (6).
+constexpr Real grad_flops = 4*NP + 8;
+//   divergence_sphere: D^-1 and metdet (8), 2 derivatives, sum and scaling (4).
+constexpr Real div_flops = 4*NP + 12;
+//   vorticity_sphere: D (6), 2 derivatives, difference and scaling (4).
+constexpr Real vort_flops = 4*NP + 10;
+//   divergence_sphere_wk: D^-1 (6), then 7 flops per term of the NP-term sum.
+constexpr Real div_wk_flops = 7*NP + 6;
+//   laplace_simple: gradient_sphere, then divergence_sphere_wk.
+constexpr Real laplace_flops = grad_flops + div_wk_flops;
+//   vlaplace_sphere_wk_contra, both components: divergence_sphere and the
+//   nu_ratio scaling, grad_sphere_wk_testcov (20 flops per term, D and
+//   scaling 8), vorticity_sphere, curl_sphere_wk_testcov_update (6 per term,
+//   D, scaling and update 12), and the final 2*spheremp*v term (8).
+constexpr Real vlaplace_flops = (div_flops + 1) + (20*NP + 8) + vort_flops
+                              + (6*NP + 12) + 8;
+
+// Caar. Operators: div(v dp), div(v vtheta_dp), vorticity, and grad of pi,
+// phinh_i, w_i (twice: once for w_tens, once for the w*grad(w) term),
+// average(w^2/2), exner, and KE. Pointwise work, by compute_* section: v dp
+// (2), the pi and omega scans and midpoints (7), omega += v.grad(pi) (4), EOS
+// (7), phi midpoints (2), interface dp, v, and dpnh_dp_i (12), accumulated
+// omega_p and vn0 (6), w and phi tendencies (13) and np1 values (10), v
+// vtheta_dp (2), dp3d and vtheta_dp np1 values (13), the v_tens terms (27) and
+// their assembly (14), v np1 values (12), and the post-exchange rspheremp
+// scaling of the 6 state fields (6): 137 in all.
+// Bytes: v, w_i, phinh_i, vtheta_dp, dp3d (6 level-resolved fields) read at n0
+// and nm1 and written at np1 (18), omega_p and vn0 updated (6), the exchange of
+// the 6 np1 fields (18), and the post-exchange scaling (12).
+const KernelCost caar_cost = {2*div_flops + vort_flops + 7*grad_flops + 137,
+                              18 + 6 + 18 + 12};
+
+// DIRK. The Newton iteration count depends on the state, so it is measured
+// (see DirkFunctorImpl::get_newton_counts) rather than assumed, as the mean
+// per element and call. Per iteration: EOS and dpnh_dp_i (11), residual (5),
+// step and the positivity check on dphi (9), and the triangular solves of the
+// tridiagonal system (5). Per Jacobian factorization, which is every iteration
+// unless modified Newton is on: Jacobian entries (9) and elimination (3).
+// Outside the loop: each of the two accum_n0 stage values (gwh_i, dphi, EOS,
+// w_n0 and phi_n0 updates: 29), and the np1 gwh_i, initial guess, and final
+// phi update (22).
+// Bytes: w_i, phinh_i, vtheta_dp, dp3d, and v (6) read at each of nm1, n0, np1
+// (18), the initial guess read, and w_i, phinh_i written (3).
+KernelCost dirk_cost (const Real niter, const Real nfactor) {
+  return {30*niter + 12*nfactor + 2*29 + 22, 18 + 3};
+}
+
+// Hyperviscosity, per subcycle: laplace_simple of dp3d, vtheta, w_i, phinh_i
+// and vlaplace_sphere_wk_contra of v, twice (the biharmonic), the reference
+// state subtraction and addition (6), the dpdiss accumulation and nu scaling
+// (12), and the state update (18). Plus the vtheta_dp <-> theta conversion
+// around the subcycles (2).
+// Bytes, per subcycle: the first Laplacian reads the 6 state and 3 reference
+// fields and writes 3 states and 6 tensors (18); the second reads and writes
+// the 6 tensors, and the pre-exchange updates dp3d, vtheta_dp, phinh_i, and
+// the 2 dpdiss fields and reads 3 reference fields (25); the tensors are
+// exchanged (18); the update reads the tensors and updates the states (18).
+// Plus the conversions (6).
+KernelCost hv_cost (const int subcycle) {
+  const Real per_subcycle = 2*(4*laplace_flops + vlaplace_flops) + 6 + 12 + 18;
+  return {subcycle*per_subcycle + 2, subcycle*(18.0 + 25 + 18 + 18) + 6};
+}
+
+// Vertical remap, PPM, per remapped field: cell means and the mass scan (2),
+// the limited slopes (14), the interface values (13), the monotonicity limiter
+// and parabola coefficients (28), and the parabola integrals (15). The grids
+// (compute_grids, partitions, and integral bounds) are shared by all fields
+// (~50). The remapped fields are the 6 state fields and the tracers. Each field
+// is read and written once, plus dp3d and the source/target grids.
+KernelCost remap_cost (const int qsize) {
+  const int nfields = 6 + qsize;
+  return {72.0*nfields + 50, 2.0*nfields + 3};
+}
+
+struct Timing {
+  double tmin, tavg;
+};
+
+// Run once to warm up, then nrep times, calling reset before each run outside
+// the timed region. Times are the max over ranks of each repetition.
+template <typename Reset, typename Run>
+Timing time_kernel (const Comm& comm, const int nrep, const Reset& reset,
+                    const Run& run) {
+  reset();
+  run();
+  Kokkos::fence();
+  Timing t = {std::numeric_limits<double>::max(), 0};
+  for (int i = 0; i < nrep; ++i) {
+    reset();
+    Kokkos::fence();
+    MPI_Barrier(comm.mpi_comm());
+    const double t0 = MPI_Wtime();
+    run();
+    Kokkos::fence();
+    double dt = MPI_Wtime() - t0;
+    MPI_Allreduce(MPI_IN_PLACE, &dt, 1, MPI_DOUBLE, MPI_MAX, comm.mpi_comm());
+    t.tmin = std::min(t.tmin, dt);
+    t.tavg += dt/nrep;
+  }
+  return t;
+}
+
+void report (const Comm& comm, const BenchOptions& o, const char* name,
+             const KernelCost& cost, const int nelem_global, const Timing& t) {
+  if ( ! comm.root()) return;
+  const Real npts = Real(nelem_global)*NP*NP*NUM_PHYSICAL_LEV;
+  const Real gflop = cost.flops*npts*1e-9;
+  const Real gb = cost.fields_moved*npts*sizeof(Real)*1e-9;
+  const Real gflops = gflop/t.tmin, gbs = gb/t.tmin;
+  printf("kernel_bench> %-6s tmin %10.3e tavg %10.3e s  %8.2f GFLOP/s  %8.2f GB/s"
+         "  AI %5.2f flop/B", name, t.tmin, t.tavg, gflops, gbs, gflop/gb);
+  if (o.peak_gflops > 0 && o.peak_gbs > 0) {
+    const Real bound = std::min(o.peak_gflops, (gflop/gb)*o.peak_gbs);
+    printf("  %5.1f%% of roofline (%s-bound)", 100*gflops/bound,
+           bound < o.peak_gflops ? "memory" : "compute");
+  }
+  printf("\n");
+}
+
+// Copies of the fields the functors overwrite, so each repetition starts from
+// the same state.
+struct StateCopy {
+  ElementsState s;
+  decltype(Tracers::qdp) qdp;
+
+  StateCopy (const Elements& e, const Tracers& t)
+    : qdp("qdp", t.qdp.extent(0))
+  {
+    s.init(e.num_elems());
+    save(e, t);
+  }
+
+  void save (const Elements& e, const Tracers& t) {
+    copy(e.m_state, s);
+    Kokkos::deep_copy(qdp, t.qdp);
+  }
+
+  void restore (const Elements& e, const Tracers& t) const {
+    copy(s, e.m_state);
+    Kokkos::deep_copy(t.qdp, qdp);
+  }
+
+private:
+  static void copy (const ElementsState& src, const ElementsState& dst) {
+    Kokkos::deep_copy(dst.m_v, src.m_v);
+    Kokkos::deep_copy(dst.m_w_i, src.m_w_i);
+    Kokkos::deep_copy(dst.m_vtheta_dp, src.m_vtheta_dp);
+    Kokkos::deep_copy(dst.m_phinh_i, src.m_phinh_i);
+    Kokkos::deep_copy(dst.m_dp3d, src.m_dp3d);
+    Kokkos::deep_copy(dst.m_ps_v, src.m_ps_v);
+  }
+};
+
+// Make sure dphi <= -g, as in dirk_ut, so the DIRK Newton solve converges.
+void make_phinh_hydrostatically_plausible (const Elements& e) {
+  const auto phis = Kokkos::create_mirror_view(e.m_geometry.m_phis);
+  const auto phinh_i = Kokkos::create_mirror_view(e.m_state.m_phinh_i);
+  Kokkos::deep_copy(phis, e.m_geometry.m_phis);
+  Kokkos::deep_copy(phinh_i, e.m_state.m_phinh_i);
+  const int nlev = NUM_PHYSICAL_LEV;
+  for (int ie = 0; ie < e.num_elems(); ++ie)
+    for (int t = 0; t < NUM_TIME_LEVELS; ++t)
+      for (int i = 0; i < NP; ++i)
+        for (int j = 0; j < NP; ++j) {
+          Real* const phi = &phinh_i(ie,t,i,j,0)[0];
+          phi[nlev] = phis(ie,i,j);
+          for (int k = nlev-1; k >= 0; --k)
+            if (phi[k] - phi[k+1] < PhysicalConstants::g)
+              for (int k1 = k; k1 >= 0; --k1)
+                phi[k1] += PhysicalConstants::g;
+        }
+  Kokkos::deep_copy(e.m_state.m_phinh_i, phinh_i);
+}
+
+} // anonymous namespace
+
+TEST_CASE("kernel_bench", "[bench]") {
+  auto& c = Context::singleton();
+  const auto& comm = c.get<Comm>();
+
+  BenchOptions o;
+  o.parse_command_line(comm.root());
+
+  const unsigned int catchRngSeed = Catch::rngSeed();
+  const unsigned int seed = catchRngSeed==0 ? std::random_device()() : catchRngSeed;
+
+  // Init parameters: nonhydrostatic, conservative theta advection, rsplit>0
+  // so that the remap does the full state, constant coefficient HV without
+  // the sponge layer.
+  auto& params = c.create<SimulationParams>();
+  params.params_set = true;
+  params.dp3d_thresh = 0.125;
+  params.vtheta_thresh = 100.0;
+  params.theta_hydrostatic_mode = false;
+  params.theta_adv_form = AdvectionForm::Conservative;
+  params.rsplit = 3;
+  params.remap_alg = RemapAlg::PPM_MIRRORED;
+  params.qsize = o.qsize;
+  params.nu = 1e15;
+  params.nu_p = params.nu_s = params.nu_div = params.nu;
+  params.nu_ratio1 = params.nu_ratio2 = 1;
+  params.nu_top = 0;
+  params.hypervis_order = 2;
+  params.hypervis_scaling = 0;
+  params.hypervis_subcycle = o.hvsub;
+  params.hypervis_subcycle_tom = 0;
+
+  auto& hvcoord = c.create<HybridVCoord>();
+  auto& ref_FE  = c.create<ReferenceElement>();
+  hvcoord.random_init(seed);
+
+  auto hyai = Kokkos::create_mirror_view(hvcoord.hybrid_ai);
+  auto hybi = Kokkos::create_mirror_view(hvcoord.hybrid_bi);
+  auto hyam = Kokkos::create_mirror_view(hvcoord.hybrid_am);
+  auto hybm = Kokkos::create_mirror_view(hvcoord.hybrid_bm);
+  Kokkos::deep_copy(hyai,hvcoord.hybrid_ai);
+  Kokkos::deep_copy(hybi,hvcoord.hybrid_bi);
+  Kokkos::deep_copy(hyam,hvcoord.hybrid_am);
+  Kokkos::deep_copy(hybm,hvcoord.hybrid_bm);
+  const Real* hyai_ptr  = hyai.data();
+  const Real* hybi_ptr  = hybi.data();
+  const Real* hyam_ptr  = reinterpret_cast<Real*>(hyam.data());
+  const Real* hybm_ptr  = reinterpret_cast<Real*>(hybm.data());
+
+  std::vector<Real> dvv(NP*NP);
+  std::vector<Real> mp(NP*NP);
+
+  // This will also init the c connectivity.
+  init_caar_f90(o.ne,hyai_ptr,hybi_ptr,hyam_ptr,hybm_ptr,dvv.data(),mp.data(),hvcoord.ps0);
+  ref_FE.init_mass(mp.data());
+  ref_FE.init_deriv(dvv.data());
+
+  const int num_elems = c.get<Connectivity>().get_num_local_elements();
+  int num_elems_global = num_elems;
+  MPI_Allreduce(MPI_IN_PLACE, &num_elems_global, 1, MPI_INT, MPI_SUM, comm.mpi_comm());
+
+  auto& elems = c.create<Elements>();
+  elems.init(num_elems,false,true,PhysicalConstants::rearth0);
+  const auto max_pressure = 1000.0 + hvcoord.ps0; // This ensures max_p > ps0
+  auto& geo = elems.m_geometry;
+  elems.m_geometry.randomize(seed); // Only needed for phis and gradphis
+
+  auto& tracers = c.create<Tracers>();
+  tracers.init(num_elems,params.qsize);
+
+  // Use the F90 geometry, so the metric terms are realistic.
+  {
+    auto d        = Kokkos::create_mirror_view(geo.m_d);
+    auto dinv     = Kokkos::create_mirror_view(geo.m_dinv);
+    auto phis     = Kokkos::create_mirror_view(geo.m_phis);
+    auto gradphis = Kokkos::create_mirror_view(geo.m_gradphis);
+    auto fcor     = Kokkos::create_mirror_view(geo.m_fcor);
+    auto spmp     = Kokkos::create_mirror_view(geo.m_spheremp);
+    auto rspmp    = Kokkos::create_mirror_view(geo.m_rspheremp);
+    auto tVisc    = Kokkos::create_mirror_view(geo.m_tensorvisc);
+    auto sph2c    = Kokkos::create_mirror_view(geo.m_vec_sph2cart);
+    auto mdet     = Kokkos::create_mirror_view(geo.m_metdet);
+    auto minv     = Kokkos::create_mirror_view(geo.m_metinv);
+    Kokkos::deep_copy(phis,geo.m_phis);
+    Kokkos::deep_copy(gradphis,geo.m_gradphis);
+
+    Real* d_ptr        = d.data();
+    Real* dinv_ptr     = dinv.data();
+    Real* spmp_ptr     = spmp.data();
+    Real* rspmp_ptr    = rspmp.data();
+    Real* tVisc_ptr    = tVisc.data();
+    Real* sph2c_ptr    = sph2c.data();
+    Real* mdet_ptr     = mdet.data();
+    Real* minv_ptr     = minv.data();
+    const Real* phis_ptr     = phis.data();
+    const Real* gradphis_ptr = gradphis.data();
+    Real* fcor_ptr     = fcor.data();
+
+    init_geo_views_f90(d_ptr,dinv_ptr,phis_ptr,gradphis_ptr,fcor_ptr,
+                       spmp_ptr,rspmp_ptr,tVisc_ptr,
+                       sph2c_ptr,mdet_ptr,minv_ptr);
+
+    Kokkos::deep_copy(geo.m_d,d);
+    Kokkos::deep_copy(geo.m_dinv,dinv);
+    Kokkos::deep_copy(geo.m_spheremp,spmp);
+    Kokkos::deep_copy(geo.m_rspheremp,rspmp);
+    Kokkos::deep_copy(geo.m_tensorvisc,tVisc);
+    Kokkos::deep_copy(geo.m_vec_sph2cart,sph2c);
+    Kokkos::deep_copy(geo.m_metdet,mdet);
+    Kokkos::deep_copy(geo.m_metinv,minv);
+    Kokkos::deep_copy(geo.m_fcor,fcor);
+  }
+
+  auto& bm = c.create<MpiBuffersManager>();
+  auto& bmm = c.create<MpiBuffersManagerMap>();
+  auto& sphop = c.create<SphereOperators>();
+  auto& limiter = c.create<LimiterFunctor>(elems,hvcoord,params);
+  sphop.setup(geo,ref_FE);
+  if (!bm.is_connectivity_set ()) {
+    bm.set_connectivity(c.get_ptr<Connectivity>());
+  }
+  if (!bmm.is_connectivity_set ()) {
+    bmm.set_connectivity(c.get_ptr<Connectivity>());
+  }
+
+  // Randomize the state once; every repetition restarts from it.
+  elems.m_state.randomize(seed,max_pressure,hvcoord.ps0,hvcoord.hybrid_ai0,geo.m_phis);
+  elems.m_derived.randomize(seed,10);
+  tracers.randomize(seed);
+  make_phinh_hydrostatically_plausible(elems);
+  const StateCopy state0(elems, tracers);
+  const auto reset = [&] () { state0.restore(elems, tracers); };
+
+  if (comm.root())
+    printf("kernel_bench> ne %d nelem %d ranks %d concurrency %d NP %d NUM_LEV %d"
+           " (physical %d) VECTOR_SIZE %d qsize %d hvsub %d nrep %d\n",
+           o.ne, num_elems_global, comm.size(), int(ExecSpace::concurrency()),
+           NP, NUM_LEV, NUM_PHYSICAL_LEV, VECTOR_SIZE, o.qsize, o.hvsub, o.nrep);
+
+  const int nm1 = 0, n0 = 1, np1 = 2;
+  const Real dt = 1;
+
+  {
+    CaarFunctorImpl caar(elems,tracers,ref_FE,hvcoord,sphop,params);
+    FunctorsBuffersManager fbm;
+    fbm.request_size(caar.requested_buffer_size());
+    fbm.request_size(limiter.requested_buffer_size());
+    fbm.allocate();
+    caar.init_buffers(fbm);
+    limiter.init_buffers(fbm);
+    caar.init_boundary_exchanges(c.get_ptr<MpiBuffersManager>());
+    const RKStageData data(nm1, n0, np1, 0, dt, 0.5);
+    const auto t = time_kernel(comm, o.nrep, reset, [&] () { caar.run(data); });
+    report(comm, o, "caar", caar_cost, num_elems_global, t);
+  }
+
+  {
+    DirkFunctorImpl dirk(num_elems);
+    FunctorsBuffersManager fbm;
+    fbm.request_size(dirk.requested_buffer_size());
+    fbm.allocate();
+    dirk.init_buffers(fbm);
+    const Real dt2 = 0.15;
+    const auto t = time_kernel(comm, o.nrep, reset, [&] () {
+      dirk.run(nm1, 0.3*dt2, n0, 0.7*dt2, np1, dt2, elems, hvcoord);
+    });
+    // The counts are totals over this rank's elements and all calls,
+    // including the warmup one.
+    int counts[2];
+    dirk.get_newton_counts(counts[0], counts[1]);
+    MPI_Allreduce(MPI_IN_PLACE, counts, 2, MPI_INT, MPI_SUM, comm.mpi_comm());
+    const Real ncalls = Real(num_elems_global)*(o.nrep + 1);
+    if (comm.root())
+      printf("kernel_bench> dirk   mean Newton iterations %5.2f factorizations %5.2f\n",
+             counts[0]/ncalls, counts[1]/ncalls);
+    report(comm, o, "dirk", dirk_cost(counts[0]/ncalls, counts[1]/ncalls),
+           num_elems_global, t);
+  }
+
+  {
+    HyperviscosityFunctorImpl hv(params, geo, elems.m_state, elems.m_derived);
+    FunctorsBuffersManager fbm;
+    fbm.request_size(hv.requested_buffer_size());
+    fbm.allocate();
+    hv.init_buffers(fbm);
+    hv.init_boundary_exchanges();
+    const auto t = time_kernel(comm, o.nrep, reset, [&] () {
+      hv.run(np1, dt, 1.0);
+    });
+    report(comm, o, "hv", hv_cost(o.hvsub), num_elems_global, t);
+  }
+
+  {
+    VerticalRemapManager vrm;
+    FunctorsBuffersManager fbm;
+    fbm.request_size(vrm.requested_buffer_size());
+    fbm.allocate();
+    vrm.init_buffers(fbm);
+    const auto t = time_kernel(comm, o.nrep, reset, [&] () {
+      vrm.run_remap(np1, 0, dt);
+    });
+    report(comm, o, "remap", remap_cost(o.qsize), num_elems_global, t);
+  }
+
+  // Cleanup (see caar_ut for the treatment of Comm).
+  auto old_comm = c.get_ptr<Comm>();
+  c.finalize_singleton();
+  auto& new_comm = c.create<Comm>();
+  new_comm = *old_comm;
+
+  cleanup_f90();
+}